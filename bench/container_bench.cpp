@@ -0,0 +1,243 @@
+#include <unrolled_list.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Pod64 {
+    int64_t fields[8];
+
+    bool operator==(const Pod64& other) const {
+        return fields[0] == other.fields[0];
+    }
+};
+
+template<typename T>
+T MakeValue(size_t i) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return std::string(32, static_cast<char>('a' + i % 26)) + std::to_string(i);
+    } else if constexpr (std::is_same_v<T, Pod64>) {
+        return Pod64{{static_cast<int64_t>(i)}};
+    } else {
+        return static_cast<T>(i);
+    }
+}
+
+template<typename C>
+concept HasNth = requires(C c, size_t n) { c.nth(n); };
+
+template<typename C>
+concept HasSubscript = requires(C c, size_t n) { c[n]; };
+
+template<typename C>
+concept HasPushFront = requires(C c, typename C::value_type v) { c.push_front(v); };
+
+template<typename C>
+auto Middle(C& container) {
+    if constexpr (HasNth<C>) {
+        return container.nth(container.size() / 2);
+    } else if constexpr (std::random_access_iterator<typename C::iterator>) {
+        return container.begin() + container.size() / 2;
+    } else {
+        return std::next(container.begin(), container.size() / 2);
+    }
+}
+
+template<typename C>
+C Filled(size_t size) {
+    C container;
+    for (size_t i = 0; i < size; ++i) {
+        container.push_back(MakeValue<typename C::value_type>(i));
+    }
+    return container;
+}
+
+template<typename C>
+void PushBack(benchmark::State& state) {
+    const size_t size = state.range(0);
+    for (auto _ : state) {
+        C container;
+        for (size_t i = 0; i < size; ++i) {
+            container.push_back(MakeValue<typename C::value_type>(i));
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+template<typename C>
+void PushFront(benchmark::State& state) {
+    const size_t size = state.range(0);
+    for (auto _ : state) {
+        C container;
+        for (size_t i = 0; i < size; ++i) {
+            container.push_front(MakeValue<typename C::value_type>(i));
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+template<typename C>
+void PopFront(benchmark::State& state) {
+    const size_t size = state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        C container = Filled<C>(size);
+        state.ResumeTiming();
+        while (!container.empty()) {
+            container.pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+template<typename C>
+void PopBack(benchmark::State& state) {
+    const size_t size = state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        C container = Filled<C>(size);
+        state.ResumeTiming();
+        while (!container.empty()) {
+            container.pop_back();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+template<typename C>
+void InsertMiddle(benchmark::State& state) {
+    C container = Filled<C>(state.range(0));
+    const auto value = MakeValue<typename C::value_type>(7);
+    for (auto _ : state) {
+        container.insert(Middle(container), value);
+        state.PauseTiming();
+        container.pop_back();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename C>
+void EraseMiddle(benchmark::State& state) {
+    C container = Filled<C>(state.range(0));
+    const auto value = MakeValue<typename C::value_type>(7);
+    for (auto _ : state) {
+        container.erase(Middle(container));
+        state.PauseTiming();
+        container.push_back(value);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename C>
+void Iterate(benchmark::State& state) {
+    const C container = Filled<C>(state.range(0));
+    for (auto _ : state) {
+        size_t touched = 0;
+        for (const auto& item : container) {
+            benchmark::DoNotOptimize(&item);
+            ++touched;
+        }
+        benchmark::DoNotOptimize(touched);
+    }
+    state.SetItemsProcessed(state.iterations() * container.size());
+}
+
+template<typename C>
+void Find(benchmark::State& state) {
+    const C container = Filled<C>(state.range(0));
+    const auto missing = MakeValue<typename C::value_type>(container.size() + 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::find(container.begin(), container.end(), missing));
+    }
+    state.SetItemsProcessed(state.iterations() * container.size());
+}
+
+template<typename C>
+void PositionalAccess(benchmark::State& state) {
+    const C container = Filled<C>(state.range(0));
+    const size_t size = container.size();
+    size_t pos = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(&container[pos]);
+        pos = (pos + 7919) % size;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename C>
+void Copy(benchmark::State& state) {
+    const C container = Filled<C>(state.range(0));
+    for (auto _ : state) {
+        C copy(container);
+        benchmark::DoNotOptimize(&copy);
+    }
+    state.SetItemsProcessed(state.iterations() * container.size());
+}
+
+template<typename C>
+void CopyAssign(benchmark::State& state) {
+    const C container = Filled<C>(state.range(0));
+    C target = container;
+    for (auto _ : state) {
+        target = container;
+        benchmark::DoNotOptimize(&target);
+    }
+    state.SetItemsProcessed(state.iterations() * container.size());
+}
+
+template<typename C>
+void RegisterContainer(const std::string& name) {
+    const auto add = [&](const char* op, void (*fn)(benchmark::State&)) {
+        benchmark::RegisterBenchmark((std::string(op) + "/" + name).c_str(), fn)
+            ->Arg(1 << 10)
+            ->Arg(1 << 16);
+    };
+
+    add("push_back", PushBack<C>);
+    add("pop_back", PopBack<C>);
+    if constexpr (HasPushFront<C>) {
+        add("push_front", PushFront<C>);
+        add("pop_front", PopFront<C>);
+    }
+    add("insert_middle", InsertMiddle<C>);
+    add("erase_middle", EraseMiddle<C>);
+    add("iterate", Iterate<C>);
+    add("find", Find<C>);
+    add("copy", Copy<C>);
+    add("copy_assign", CopyAssign<C>);
+    if constexpr (HasSubscript<C>) {
+        add("positional_access", PositionalAccess<C>);
+    }
+}
+
+template<typename T>
+void RegisterForType(const std::string& type_name) {
+    RegisterContainer<std::vector<T>>("vector<" + type_name + ">");
+    RegisterContainer<std::deque<T>>("deque<" + type_name + ">");
+    RegisterContainer<std::list<T>>("list<" + type_name + ">");
+    RegisterContainer<unrolled_list<T, 4>>("unrolled_list<" + type_name + ",4>");
+    RegisterContainer<unrolled_list<T, 16>>("unrolled_list<" + type_name + ",16>");
+    RegisterContainer<unrolled_list<T, 64>>("unrolled_list<" + type_name + ",64>");
+    RegisterContainer<unrolled_list<T, 256>>("unrolled_list<" + type_name + ",256>");
+    RegisterContainer<unrolled_list<T, 1024>>("unrolled_list<" + type_name + ",1024>");
+}
+
+const bool kRegistered = [] {
+    RegisterForType<int>("int");
+    RegisterForType<Pod64>("pod64");
+    RegisterForType<std::string>("string");
+    return true;
+}();
+
+} // namespace
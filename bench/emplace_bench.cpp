@@ -0,0 +1,101 @@
+#include <unrolled_list.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace {
+
+// Counts allocations made by the list and its strings only, so the rest of
+// the suite keeps the default operator new
+size_t g_allocations = 0;
+
+template<typename T>
+struct CountingAlloc {
+    using value_type = T;
+
+    CountingAlloc() = default;
+
+    template<typename U>
+    CountingAlloc(const CountingAlloc<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        ++g_allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    template<typename U>
+    bool operator==(const CountingAlloc<U>&) const noexcept {
+        return true;
+    }
+};
+
+using CountedString = std::basic_string<char, std::char_traits<char>, CountingAlloc<char>>;
+
+constexpr size_t kElements = 4096;
+const CountedString kPayload(64, 'x');
+
+template<typename Insert>
+void RunWithAllocationCounter(benchmark::State& state, Insert insert) {
+    size_t allocations = 0;
+    for (auto _ : state) {
+        unrolled_list<CountedString, 64, CountingAlloc<CountedString>> list;
+        const size_t before = g_allocations;
+        for (size_t i = 0; i < kElements; ++i) {
+            insert(list);
+        }
+        allocations += g_allocations - before;
+        benchmark::DoNotOptimize(list);
+    }
+
+    state.SetItemsProcessed(state.iterations() * kElements);
+    state.counters["allocs_per_insert"] = benchmark::Counter(
+        static_cast<double>(allocations) / (state.iterations() * kElements));
+}
+
+void BM_PushBackCopy(benchmark::State& state) {
+    RunWithAllocationCounter(state, [](auto& list) {
+        CountedString value = kPayload;
+        list.push_back(value);
+    });
+}
+
+void BM_PushBackMove(benchmark::State& state) {
+    RunWithAllocationCounter(state, [](auto& list) {
+        CountedString value = kPayload;
+        list.push_back(std::move(value));
+    });
+}
+
+void BM_EmplaceBack(benchmark::State& state) {
+    RunWithAllocationCounter(state, [](auto& list) {
+        list.emplace_back(64, 'x');
+    });
+}
+
+void BM_InsertMiddleCopy(benchmark::State& state) {
+    RunWithAllocationCounter(state, [](auto& list) {
+        CountedString value = kPayload;
+        list.insert(list.nth(list.size() / 2), value);
+    });
+}
+
+void BM_EmplaceMiddle(benchmark::State& state) {
+    RunWithAllocationCounter(state, [](auto& list) {
+        list.emplace(list.nth(list.size() / 2), 64, 'x');
+    });
+}
+
+} // namespace
+
+BENCHMARK(BM_PushBackCopy);
+BENCHMARK(BM_PushBackMove);
+BENCHMARK(BM_EmplaceBack);
+BENCHMARK(BM_InsertMiddleCopy);
+BENCHMARK(BM_EmplaceMiddle);
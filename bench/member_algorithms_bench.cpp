@@ -0,0 +1,78 @@
+#include <unrolled_list.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr int kSize = 1 << 16;
+
+unrolled_list<int> Shuffled() {
+    std::mt19937 rng(1);
+    unrolled_list<int> list;
+    for (int i = 0; i < kSize; ++i) {
+        list.push_back(static_cast<int>(rng()));
+    }
+    return list;
+}
+
+} // namespace
+
+// What callers did before the member sort existed.
+static void BM_SortViaVector(benchmark::State& state) {
+    const auto source = Shuffled();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto list = source;
+        state.ResumeTiming();
+        std::vector<int> buffer(list.begin(), list.end());
+        std::sort(buffer.begin(), buffer.end());
+        list = unrolled_list<int>(buffer.begin(), buffer.end());
+        benchmark::DoNotOptimize(list);
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_SortViaVector);
+
+static void BM_SortMember(benchmark::State& state) {
+    const auto source = Shuffled();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto list = source;
+        state.ResumeTiming();
+        list.sort();
+        benchmark::DoNotOptimize(list);
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_SortMember);
+
+static void BM_RemoveIfErase(benchmark::State& state) {
+    const auto source = Shuffled();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto list = source;
+        state.ResumeTiming();
+        for (auto it = list.begin(); it != list.end();) {
+            it = *it % 2 != 0 ? list.erase(it) : std::next(it);
+        }
+        benchmark::DoNotOptimize(list);
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_RemoveIfErase);
+
+static void BM_RemoveIfMember(benchmark::State& state) {
+    const auto source = Shuffled();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto list = source;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(list.remove_if([](int value) { return value % 2 != 0; }));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_RemoveIfMember);
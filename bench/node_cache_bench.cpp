@@ -0,0 +1,42 @@
+#include <unrolled_list.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+
+// Queue churn where every node is freed at the front and a new one is needed
+// at the back. The argument is the node cache limit, 0 means every node goes
+// straight to std::allocator.
+static void BM_QueueChurn(benchmark::State& state) {
+    unrolled_list<int, 16> list;
+    list.set_node_cache_limit(state.range(0));
+    for (int i = 0; i < 1024; ++i) {
+        list.push_back(i);
+    }
+
+    int i = 0;
+    for (auto _ : state) {
+        list.push_back(++i);
+        list.pop_front();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_QueueChurn)->Arg(0)->Arg(1)->Arg(unrolled_list_default_node_cache)->Arg(64);
+
+// Fill and clear the same list, so after the first round all nodes can come
+// from the cache if it is large enough.
+static void BM_RefillAfterClear(benchmark::State& state) {
+    constexpr int kSize = 1 << 14;
+    unrolled_list<int, 16> list;
+    list.set_node_cache_limit(state.range(0));
+    list.reserve_nodes(state.range(0));
+
+    for (auto _ : state) {
+        for (int i = 0; i < kSize; ++i) {
+            list.push_back(i);
+        }
+        list.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_RefillAfterClear)->Arg(0)->Arg((1 << 14) / 16);
@@ -0,0 +1,59 @@
+#include <unrolled_list.hpp>
+#include <unrolled_list_parallel.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <execution>
+#include <random>
+
+namespace {
+
+constexpr int kSize = 1 << 22;
+
+unrolled_list<int64_t, 512> RandomList() {
+    std::mt19937_64 rng(1);
+    unrolled_list<int64_t, 512> list;
+    for (int i = 0; i < kSize; ++i) {
+        list.push_back(static_cast<int64_t>(rng() % 1000000));
+    }
+    return list;
+}
+
+} // namespace
+
+template<typename Policy>
+static void BM_Reduce(benchmark::State& state, Policy policy) {
+    const auto list = RandomList();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reduce(policy, list, int64_t{0}));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK_CAPTURE(BM_Reduce, seq, std::execution::seq);
+BENCHMARK_CAPTURE(BM_Reduce, par, std::execution::par);
+
+template<typename Policy>
+static void BM_CountIf(benchmark::State& state, Policy policy) {
+    const auto list = RandomList();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(count_if(policy, list, [](int64_t x) { return x % 7 == 0; }));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK_CAPTURE(BM_CountIf, seq, std::execution::seq);
+BENCHMARK_CAPTURE(BM_CountIf, par, std::execution::par);
+
+template<typename Policy>
+static void BM_Sort(benchmark::State& state, Policy policy) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto list = RandomList();
+        state.ResumeTiming();
+        sort(policy, list);
+        benchmark::DoNotOptimize(list);
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK_CAPTURE(BM_Sort, seq, std::execution::seq)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Sort, par, std::execution::par)->Unit(benchmark::kMillisecond);
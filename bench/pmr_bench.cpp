@@ -0,0 +1,49 @@
+#include <unrolled_list.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <memory_resource>
+#include <optional>
+
+// Build and destroy a request-scoped list. With a monotonic resource the
+// teardown does not walk the nodes at all.
+static void BM_PmrBuildAndDestroy(benchmark::State& state) {
+    const bool monotonic = state.range(0) != 0;
+    const int size = state.range(1);
+
+    for (auto _ : state) {
+        std::pmr::monotonic_buffer_resource arena;
+        std::pmr::memory_resource* resource = monotonic ? &arena : std::pmr::new_delete_resource();
+
+        unrolled_list_pmr<int, 64> list(resource);
+        for (int i = 0; i < size; ++i) {
+            list.push_back(i);
+        }
+        benchmark::DoNotOptimize(list);
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_PmrBuildAndDestroy)->ArgsProduct({{0, 1}, {1 << 10, 1 << 16}});
+
+static void BM_PmrClear(benchmark::State& state) {
+    const bool monotonic = state.range(0) != 0;
+    const int size = state.range(1);
+
+    std::optional<std::pmr::monotonic_buffer_resource> arena;
+    std::optional<unrolled_list_pmr<int, 64>> list;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        list.reset();
+        arena.emplace();
+        list.emplace(monotonic ? &*arena : std::pmr::new_delete_resource());
+        list->set_node_cache_limit(0);
+        for (int i = 0; i < size; ++i) {
+            list->push_back(i);
+        }
+        state.ResumeTiming();
+
+        list->clear();
+    }
+}
+BENCHMARK(BM_PmrClear)->ArgsProduct({{0, 1}, {1 << 10, 1 << 16}});
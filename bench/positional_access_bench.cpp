@@ -0,0 +1,43 @@
+#include <unrolled_list.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<size_t> RandomPositions(size_t size, size_t count) {
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<size_t> dist(0, size - 1);
+
+    std::vector<size_t> positions(count);
+    for (auto& pos : positions) {
+        pos = dist(rng);
+    }
+    return positions;
+}
+
+template<typename Container>
+void BM_RandomAccess(benchmark::State& state) {
+    const size_t size = state.range(0);
+    Container container;
+    for (size_t i = 0; i < size; ++i) {
+        container.push_back(static_cast<int>(i));
+    }
+
+    const auto positions = RandomPositions(size, 1024);
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(container[positions[i++ & 1023]]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_RandomAccess<std::deque<int>>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_RandomAccess<unrolled_list<int, 64>>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_RandomAccess<unrolled_list<int, 256>>)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_RandomAccess<unrolled_list<int, 64, std::allocator<int>, unrolled_list_node_index>>)->RangeMultiplier(10)->Range(1000, 1000000);
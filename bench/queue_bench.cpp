@@ -0,0 +1,43 @@
+#include <unrolled_list.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+
+namespace {
+
+template<typename Container>
+void BM_Fifo(benchmark::State& state) {
+    const size_t depth = state.range(0);
+    Container queue;
+    for (size_t i = 0; i < depth; ++i) {
+        queue.push_back(static_cast<int>(i));
+    }
+
+    int value = 0;
+    for (auto _ : state) {
+        queue.push_back(value++);
+        benchmark::DoNotOptimize(queue.front());
+        queue.pop_front();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Container>
+void BM_PushFront(benchmark::State& state) {
+    for (auto _ : state) {
+        Container container;
+        for (int i = 0; i < 10000; ++i) {
+            container.push_front(i);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * 10000);
+}
+
+} // namespace
+
+BENCHMARK(BM_Fifo<std::deque<int>>)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_Fifo<unrolled_list<int, 256>>)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_PushFront<std::deque<int>>);
+BENCHMARK(BM_PushFront<unrolled_list<int, 256>>);
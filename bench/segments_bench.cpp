@@ -0,0 +1,78 @@
+#include <unrolled_list.hpp>
+#include <unrolled_list_algorithm.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+constexpr int kSize = 1 << 16;
+
+template<typename C>
+C Iota() {
+    C container;
+    for (int i = 0; i < kSize; ++i) {
+        container.push_back(i);
+    }
+    return container;
+}
+
+} // namespace
+
+static void BM_AccumulateVector(benchmark::State& state) {
+    const auto vector = Iota<std::vector<int>>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(vector.begin(), vector.end(), 0L));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_AccumulateVector);
+
+static void BM_AccumulateIterator(benchmark::State& state) {
+    const auto list = Iota<unrolled_list<int>>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(list.begin(), list.end(), 0L));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_AccumulateIterator);
+
+static void BM_AccumulateSegments(benchmark::State& state) {
+    const auto list = Iota<unrolled_list<int>>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(accumulate(list, 0L));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_AccumulateSegments);
+
+static void BM_FindIterator(benchmark::State& state) {
+    const auto list = Iota<unrolled_list<int>>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::find(list.begin(), list.end(), -1));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_FindIterator);
+
+static void BM_FindSegments(benchmark::State& state) {
+    const auto list = Iota<unrolled_list<int>>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(find(list, -1));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_FindSegments);
+
+static void BM_CopySegments(benchmark::State& state) {
+    const auto list = Iota<unrolled_list<int>>();
+    std::vector<int> out(kSize);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(copy(list, out.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_CopySegments);
@@ -0,0 +1,97 @@
+#include <unrolled_list.hpp>
+#include <unrolled_list_simd.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <numeric>
+
+// Full scans over a telemetry-like unrolled_list<int64_t, 512>. The argument
+// is the instruction set, from scalar (0) to AVX-512 (3).
+
+namespace {
+
+using unrolled_list_simd::isa;
+
+constexpr int kSize = 1 << 18;
+
+const unrolled_list<int64_t, 512>& Telemetry() {
+    static const auto list = [] {
+        unrolled_list<int64_t, 512> result;
+        for (int i = 0; i < kSize; ++i) {
+            result.push_back((i * 7919) % 100003);
+        }
+        return result;
+    }();
+    return list;
+}
+
+bool SkipUnsupported(benchmark::State& state) {
+    if (static_cast<isa>(state.range(0)) > unrolled_list_simd::best_isa()) {
+        state.SkipWithError("instruction set not supported by this CPU");
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+static void BM_SimdSum(benchmark::State& state) {
+    if (SkipUnsupported(state)) return;
+    const auto& list = Telemetry();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(unrolled_list_simd::sum(list, static_cast<isa>(state.range(0))));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_SimdSum)->DenseRange(0, 3);
+
+static void BM_SimdCount(benchmark::State& state) {
+    if (SkipUnsupported(state)) return;
+    const auto& list = Telemetry();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(unrolled_list_simd::count(list, int64_t{42}, static_cast<isa>(state.range(0))));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_SimdCount)->DenseRange(0, 3);
+
+static void BM_SimdCountIf(benchmark::State& state) {
+    if (SkipUnsupported(state)) return;
+    const auto& list = Telemetry();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            unrolled_list_simd::count_if(list, std::greater<>(), int64_t{50000}, static_cast<isa>(state.range(0))));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_SimdCountIf)->DenseRange(0, 3);
+
+static void BM_SimdFind(benchmark::State& state) {
+    if (SkipUnsupported(state)) return;
+    const auto& list = Telemetry();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(unrolled_list_simd::find(list, int64_t{-1}, static_cast<isa>(state.range(0))));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_SimdFind)->DenseRange(0, 3);
+
+static void BM_SimdMax(benchmark::State& state) {
+    if (SkipUnsupported(state)) return;
+    const auto& list = Telemetry();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(unrolled_list_simd::max(list, static_cast<isa>(state.range(0))));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_SimdMax)->DenseRange(0, 3);
+
+static void BM_IteratorSum(benchmark::State& state) {
+    const auto& list = Telemetry();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(list.begin(), list.end(), int64_t{0}));
+    }
+    state.SetItemsProcessed(state.iterations() * kSize);
+}
+BENCHMARK(BM_IteratorSum);
@@ -1,6 +1,6 @@
 #include <iostream>
 
-#include <unrolled_list.h>
+#include <unrolled_list.hpp>
 
 int main(int argc, char** argv) {
     std::cout << "Hello, world!" << std::endl;
@@ -1,14 +1,349 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <utility>
 #include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
 #include <initializer_list>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <vector>
 
 static int cnt = 0;
 
-template<typename T, size_t NodeMaxSize = 10, typename Allocator = std::allocator<T>>
+struct unrolled_list_no_index {
+    static constexpr bool indexed = false;
+
+    template<typename Node>
+    struct hook {};
+
+    template<typename Node>
+    class tree {
+    public:
+        void link_after(Node*, Node*) noexcept {}
+        void unlink(Node*) noexcept {}
+        void update(Node*) noexcept {}
+        void rebuild(Node*) noexcept {}
+        void clear() noexcept {}
+    };
+};
+
+// Keeps a treap over the nodes, ordered like the list and weighted by
+// num_elements, so nth/index_of cost O(log nodes) instead of O(nodes).
+struct unrolled_list_node_index {
+    static constexpr bool indexed = true;
+
+    template<typename Node>
+    struct hook {
+        Node* parent = nullptr;
+        Node* left = nullptr;
+        Node* right = nullptr;
+        size_t subtree_elements = 0;
+        uint32_t priority = 0;
+    };
+
+    template<typename Node>
+    class tree {
+    private:
+        Node* root = nullptr;
+        uint64_t seed = 0x9E3779B97F4A7C15ull;
+
+    public:
+        void link_after(Node* prev, Node* node) noexcept {
+            node->left = node->right = nullptr;
+            node->subtree_elements = node->num_elements;
+            node->priority = next_priority();
+
+            if (!root) {
+                node->parent = nullptr;
+                root = node;
+                return;
+            }
+
+            Node* parent;
+            if (!prev) {
+                parent = leftmost(root);
+                parent->left = node;
+            } else if (!prev->right) {
+                parent = prev;
+                parent->right = node;
+            } else {
+                parent = leftmost(prev->right);
+                parent->left = node;
+            }
+            node->parent = parent;
+
+            for (Node* p = parent; p; p = p->parent) {
+                p->subtree_elements += node->num_elements;
+            }
+
+            while (node->parent && node->parent->priority < node->priority) {
+                rotate_up(node);
+            }
+        }
+
+        void unlink(Node* node) noexcept {
+            while (node->left || node->right) {
+                Node* child;
+                if (!node->left) {
+                    child = node->right;
+                } else if (!node->right) {
+                    child = node->left;
+                } else {
+                    child = node->left->priority > node->right->priority ? node->left : node->right;
+                }
+                rotate_up(child);
+            }
+
+            Node* parent = node->parent;
+            if (!parent) {
+                root = nullptr;
+            } else if (parent->left == node) {
+                parent->left = nullptr;
+            } else {
+                parent->right = nullptr;
+            }
+
+            for (; parent; parent = parent->parent) {
+                parent->subtree_elements -= node->subtree_elements;
+            }
+        }
+
+        // Must be called after every change of node->num_elements.
+        void update(Node* node) noexcept {
+            const size_t actual = weight(node->left) + weight(node->right) + node->num_elements;
+            if (actual == node->subtree_elements) {
+                return;
+            }
+
+            for (Node* p = node->parent; p; p = p->parent) {
+                p->subtree_elements = p->subtree_elements - node->subtree_elements + actual;
+            }
+            node->subtree_elements = actual;
+        }
+
+        void rebuild(Node* head) noexcept {
+            root = nullptr;
+            for (Node* prev = nullptr; head; prev = head, head = head->next) {
+                link_after(prev, head);
+            }
+        }
+
+        void clear() noexcept {
+            root = nullptr;
+        }
+
+        std::pair<Node*, size_t> find(size_t n) const noexcept {
+            Node* node = root;
+            while (node) {
+                const size_t left = weight(node->left);
+                if (n < left) {
+                    node = node->left;
+                } else if (n < left + node->num_elements) {
+                    return {node, n - left};
+                } else {
+                    n -= left + node->num_elements;
+                    node = node->right;
+                }
+            }
+            return {nullptr, 0};
+        }
+
+        size_t rank(const Node* node) const noexcept {
+            size_t result = weight(node->left);
+            for (; node->parent; node = node->parent) {
+                if (node->parent->right == node) {
+                    result += weight(node->parent->left) + node->parent->num_elements;
+                }
+            }
+            return result;
+        }
+
+    private:
+        static size_t weight(const Node* node) noexcept {
+            return node ? node->subtree_elements : 0;
+        }
+
+        static Node* leftmost(Node* node) noexcept {
+            while (node->left) {
+                node = node->left;
+            }
+            return node;
+        }
+
+        static void pull(Node* node) noexcept {
+            node->subtree_elements = weight(node->left) + weight(node->right) + node->num_elements;
+        }
+
+        void rotate_up(Node* node) noexcept {
+            Node* parent = node->parent;
+            Node* grand = parent->parent;
+
+            if (parent->left == node) {
+                parent->left = node->right;
+                if (node->right) node->right->parent = parent;
+                node->right = parent;
+            } else {
+                parent->right = node->left;
+                if (node->left) node->left->parent = parent;
+                node->left = parent;
+            }
+
+            parent->parent = node;
+            node->parent = grand;
+            if (!grand) root = node;
+            else if (grand->left == parent) grand->left = node;
+            else grand->right = node;
+
+            pull(parent);
+            pull(node);
+        }
+
+        uint32_t next_priority() noexcept {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            return static_cast<uint32_t>(seed >> 32);
+        }
+    };
+};
+
+// Controls node density:
+//   MinFillPercent   - a node below this fill after erase is merged with a neighbour;
+//   SplitPercent     - share of elements kept in the left node when a full node splits;
+//   TailSplitPercent - the same for the tail node, where inserts tend to be append-like;
+//   Borrow           - if no merge fits, take elements from the fuller neighbour instead.
+template<size_t MinFillPercent = 50, size_t SplitPercent = 50, size_t TailSplitPercent = SplitPercent,
+         bool Borrow = false>
+struct unrolled_list_rebalance_policy {
+    static_assert(MinFillPercent <= 100 && SplitPercent <= 100 && TailSplitPercent <= 100);
+
+    static constexpr bool borrow = Borrow;
+
+    static constexpr size_t min_fill(size_t capacity) noexcept {
+        return capacity * MinFillPercent / 100;
+    }
+
+    // Number of the capacity + 1 elements that stay in the left node, in [1, capacity].
+    static constexpr size_t split_point(size_t capacity, bool at_tail) noexcept {
+        const size_t percent = at_tail ? TailSplitPercent : SplitPercent;
+        const size_t left = ((capacity + 1) * percent) / 100;
+        return std::min(std::max(left, size_t{1}), capacity);
+    }
+};
+
+using unrolled_list_default_rebalance = unrolled_list_rebalance_policy<>;
+
+// Denser nodes for workloads that mostly grow at the back.
+using unrolled_list_dense_rebalance = unrolled_list_rebalance_policy<75, 50, 90, true>;
+
+// Snapshot of what a list with unrolled_list_counting_stats did since it was
+// built or last reset. Moves count elements relocated inside or between nodes.
+struct unrolled_list_stats {
+    static constexpr size_t fill_buckets = 10;
+
+    size_t node_allocations = 0;
+    size_t node_deallocations = 0;
+    // Nodes taken from the node cache instead of the allocator.
+    size_t nodes_reused = 0;
+    size_t splits = 0;
+    size_t merges = 0;
+    size_t borrows = 0;
+    size_t element_moves = 0;
+    // Bucket i counts the nodes filled to [i, i + 1) tenths of their
+    // capacity, full nodes go to the last one. Taken when stats() is called.
+    std::array<size_t, fill_buckets> fill_histogram{};
+};
+
+struct unrolled_list_no_stats {
+    static constexpr bool enabled = false;
+
+    struct counters {
+        void count(size_t unrolled_list_stats::*, size_t = 1) noexcept {}
+        void reset() noexcept {}
+    };
+};
+
+struct unrolled_list_counting_stats {
+    static constexpr bool enabled = true;
+
+    struct counters : unrolled_list_stats {
+        void count(size_t unrolled_list_stats::* counter, size_t n = 1) noexcept {
+            this->*counter += n;
+        }
+
+        void reset() noexcept {
+            static_cast<unrolled_list_stats&>(*this) = {};
+        }
+    };
+};
+
+inline constexpr size_t unrolled_list_cache_line = 64;
+
+// Default node footprint: a few cache lines, so a node is one contiguous burst
+// for the prefetcher while inserts in the middle still shift little data.
+inline constexpr size_t unrolled_list_default_node_bytes = 8 * unrolled_list_cache_line;
+
+// Number of elements that fit in a node of Bytes bytes, header included
+// (the index hook, if any, comes on top). Never less than two.
+template<typename T, size_t Bytes>
+inline constexpr size_t unrolled_list_capacity_for_bytes = [] {
+    constexpr size_t align = std::max(alignof(T), alignof(size_t));
+    constexpr size_t header = (2 * sizeof(size_t) + 2 * sizeof(void*) + align - 1) / align * align;
+    return Bytes > header ? std::max((Bytes - header) / sizeof(T), size_t{2}) : size_t{2};
+}();
+
+// Number of freed nodes a list keeps for reuse, enough to absorb queue-like
+// churn where one end frees a node while the other needs a new one.
+inline constexpr size_t unrolled_list_default_node_cache = 4;
+
+struct unrolled_list_layout {
+    size_t element_size;
+    size_t node_capacity;
+    size_t payload_bytes;
+    size_t node_bytes;
+    size_t cache_lines;
+    // num_elements, offset, prev, next and the index hook.
+    size_t header_bytes;
+    // What the compiler adds around the payload and the header.
+    size_t padding_bytes;
+};
+
+// Run-time picture of a list's memory, see unrolled_list::occupancy().
+struct unrolled_list_occupancy {
+    size_t nodes;
+    size_t cached_nodes;
+    size_t elements;
+    size_t min_fill;
+    size_t max_fill;
+    double avg_fill;
+    // Node memory held, cached nodes included, and the part of it the
+    // elements occupy; the difference is wasted.
+    size_t bytes_allocated;
+    size_t bytes_live;
+    size_t bytes_wasted;
+    // Average over linked nodes of the bytes that are not elements: header,
+    // padding and free slots.
+    double wasted_bytes_per_node;
+};
+
+template<typename T, size_t NodeMaxSize = unrolled_list_capacity_for_bytes<T, unrolled_list_default_node_bytes>,
+         typename Allocator = std::allocator<T>,
+         typename IndexPolicy = unrolled_list_no_index,
+         typename RebalancePolicy = unrolled_list_default_rebalance,
+         typename StatsPolicy = unrolled_list_no_stats>
 class unrolled_list {
 public:
     using value_type = T;
@@ -19,20 +354,62 @@ public:
     using allocator_type = Allocator;
 
 private:
-    struct Node {
-        T elements[NodeMaxSize];
+    struct Node : IndexPolicy::template hook<Node> {
+        alignas(T) unsigned char storage[NodeMaxSize * sizeof(T)];
         size_t num_elements = 0;
+        size_t offset = 0;
         Node* prev;
         Node* next;
+
+        // Live objects occupy slots [offset, offset + num_elements), the rest is
+        // raw storage, so both ends of a node can grow without shifting.
+        T* slots() noexcept {
+            return reinterpret_cast<T*>(storage);
+        }
+
+        T* elements() noexcept {
+            return slots() + offset;
+        }
+
+        const T* elements() const noexcept {
+            return reinterpret_cast<const T*>(storage) + offset;
+        }
     };
 
+    static_assert(NodeMaxSize > 0, "a node must hold at least one element");
+
+    // Unless the allocator hooks construct/destroy, trivially copyable elements
+    // are moved with memcpy/memmove and trivially destructible ones are dropped
+    // without a destructor loop.
+    static constexpr bool plain_allocator = std::is_same_v<Allocator, std::pmr::polymorphic_allocator<T>>
+        ? !std::uses_allocator_v<T, Allocator>
+        : !requires(Allocator& a, T* p) { a.construct(p, std::declval<T&&>()); } &&
+          !requires(Allocator& a, T* p) { a.destroy(p); };
+    static constexpr bool bitwise_movable = std::is_trivially_copyable_v<T> && plain_allocator;
+    static constexpr bool trivially_destroyed = std::is_trivially_destructible_v<T> && plain_allocator;
+    // Repacking and splitting nodes moves elements where a throw could not be
+    // undone, so the operations doing it require a non-throwing move.
+    static constexpr bool nothrow_relocatable = std::is_nothrow_move_constructible_v<T>;
+
     using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeIndex = typename IndexPolicy::template tree<Node>;
 
     Node* head = nullptr;
     Node* tail = nullptr;
     size_type total_elements_cnt = 0;
     Allocator allocator;
     NodeAllocator node_allocator;
+    NodeIndex index;
+    // Freed nodes kept for reuse, linked through next.
+    Node* node_cache = nullptr;
+    size_type cached_nodes_cnt = 0;
+    size_type node_cache_max = unrolled_list_default_node_cache;
+    // Incremental compaction: the node compact_step continues from (nullptr
+    // means the head), and the steps run with every push, pop, insert and
+    // erase.
+    Node* compaction_cursor = nullptr;
+    size_type compaction_steps = 0;
+    [[no_unique_address]] typename StatsPolicy::counters counters;
 
 public:
     class iterator {
@@ -59,11 +436,11 @@ public:
         ~iterator() = default;
 
         reference operator*() const {
-            return current_node->elements[current_pos];
+            return current_node->elements()[current_pos];
         }
 
         pointer operator->() {
-            return &(current_node->elements[current_pos]);
+            return &(current_node->elements()[current_pos]);
         }
 
         iterator& operator++() {            
@@ -145,11 +522,11 @@ public:
         {}
 
         const_reference operator*() const {
-            return current_node->elements[current_pos];
+            return current_node->elements()[current_pos];
         }
 
         const_pointer operator->() const {
-            return &(current_node->elements[current_pos]);
+            return &(current_node->elements()[current_pos]);
         }
 
         const_iterator& operator++() {
@@ -209,94 +586,231 @@ public:
 
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-    unrolled_list() = default;
+    // Walks the list one node at a time, yielding the contiguous run of
+    // elements each node holds, so per-node loops can be vectorized.
+    template<bool Const>
+    class segment_iterator {
+    public:
+        using value_type = std::span<std::conditional_t<Const, const T, T>>;
+        using difference_type = ptrdiff_t;
+        using element_iterator = std::conditional_t<Const, const_iterator, iterator>;
 
-    unrolled_list(const unrolled_list& other) {
-        for (const auto& item : other) {
-            push_back(item);
+    private:
+        Node* current_node = nullptr;
+        size_type first_pos = 0;
+        Node* last_node = nullptr;
+        size_type last_pos = 0;
+
+        friend unrolled_list;
+
+        segment_iterator(Node* node, size_type first, Node* last, size_type last_at)
+        :
+            current_node(node),
+            first_pos(first),
+            last_node(last),
+            last_pos(last_at)
+        {
+            skip_empty();
         }
-    }
 
-    unrolled_list(const size_type count, const value_type value) {
-        for (size_type i = 0; i < count; ++i) {
-            push_back(value);
+        void skip_empty() noexcept {
+            if (current_node == last_node && first_pos >= last_pos) {
+                current_node = nullptr;
+            }
         }
-    }
-    
-    unrolled_list(std::initializer_list<value_type> il) {
-        for (const auto& item : il) {
-            push_back(item);
+
+    public:
+        segment_iterator() = default;
+
+        value_type operator*() const {
+            const size_type end = current_node == last_node ? last_pos : current_node->num_elements;
+            return value_type(current_node->elements() + first_pos, end - first_pos);
         }
-    }
+
+        // Iterator to the i-th element of the current segment.
+        element_iterator element(size_type i) const {
+            return element_iterator(current_node, first_pos + i);
+        }
+
+        segment_iterator& operator++() {
+            current_node = current_node == last_node ? nullptr : current_node->next;
+            first_pos = 0;
+            skip_empty();
+            return *this;
+        }
+
+        segment_iterator operator++(int) {
+            segment_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        bool operator==(const segment_iterator& other) const {
+            return current_node == other.current_node;
+        }
+    };
+
+    template<bool Const>
+    class segment_range : public std::ranges::view_interface<segment_range<Const>> {
+        segment_iterator<Const> first;
+
+        friend unrolled_list;
+
+        explicit segment_range(segment_iterator<Const> it) : first(it) {}
+
+    public:
+        segment_range() = default;
+
+        segment_iterator<Const> begin() const {
+            return first;
+        }
+
+        segment_iterator<Const> end() const {
+            return {};
+        }
+    };
+
+    unrolled_list() = default;
 
     unrolled_list(const Allocator& alloc) 
     : 
         allocator(alloc),
         node_allocator(alloc) 
+    {}
+
+    unrolled_list(const unrolled_list& other)
+    :
+        unrolled_list(other, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.allocator))
+    {}
+
+    // Takes over the nodes; other is left empty and keeps its node cache.
+    unrolled_list(unrolled_list&& other) noexcept
+    :
+        allocator(other.allocator),
+        node_allocator(other.node_allocator)
     {
-        head = nullptr;
-        tail = nullptr;
-        total_elements_cnt = 0;
+        steal_nodes(other);
     }
 
-    unrolled_list(const unrolled_list& other, const Allocator& alloc)
-        : allocator(alloc),
-          node_allocator(alloc),
-          head(other.head),
-          tail(other.tail),
-          total_elements_cnt(other.total_elements_cnt)
+    // Nodes can only change hands when the allocators are equal; otherwise the
+    // elements are moved into nodes of alloc and other is cleared.
+    unrolled_list(unrolled_list&& other, const Allocator& alloc)
+    :
+        unrolled_list(alloc)
     {
-        other.head = nullptr;
-        other.tail = nullptr;
-        other.total_elements_cnt = 0;
+        if (allocator == other.allocator) {
+            steal_nodes(other);
+        } else {
+            append_sequence(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+        }
     }
 
-    template<typename InputIt>
-    unrolled_list(InputIt i, InputIt j) {
-        unrolled_list temp;
-
-        for (; i != j; ++i) {
-            temp.push_back(*i);
+    unrolled_list(const size_type count, const value_type value, const Allocator& alloc = Allocator())
+    :
+        unrolled_list(alloc)
+    {
+        for (size_type i = 0; i < count; ++i) {
+            push_back(value);
+        }
+    }
+    
+    unrolled_list(std::initializer_list<value_type> il, const Allocator& alloc = Allocator())
+    :
+        unrolled_list(alloc)
+    {
+        for (const auto& item : il) {
+            push_back(item);
         }
+    }
 
+    // The constructors below delegate, so a throwing element copy runs the
+    // destructor and releases whatever was already built.
 
-        std::swap(temp, *this);
+    // Copies node by node, so the copy has the same fill as other.
+    unrolled_list(const unrolled_list& other, const Allocator& alloc)
+    :
+        unrolled_list(alloc)
+    {
+        clone_from(other, nullptr);
     }
 
     template<typename InputIt>
-    unrolled_list(InputIt i, InputIt j, const allocator_type& alloc)
+    unrolled_list(InputIt i, InputIt j, const allocator_type& alloc = allocator_type())
     :
-        allocator(alloc),
-        node_allocator(alloc),
-        head(nullptr),
-        tail(nullptr),
-        total_elements_cnt(0)
+        unrolled_list(alloc)
     {
-        unrolled_list temp;
-        try {
-            for (; i != j; ++i) {
-                temp.push_back(*i);
-            }
-        } catch (...) {
-            temp.~unrolled_list();
-            throw;
+        for (; i != j; ++i) {
+            push_back(*i);
         }
-        swap(temp);
     }
 
     ~unrolled_list() {
         clear();
+        shrink_to_fit();
     }
 
+    // The nodes already owned are reused for the copy unless the allocator
+    // propagates and differs, in which case they belong to the old allocator
+    // and are freed first. If an element copy throws, the list is left empty.
     unrolled_list& operator=(const unrolled_list& other) {
-        if (this != &other) {
-            unrolled_list tmp(other);
-            swap(tmp);
+        if (this == &other) {
+            return *this;
         }
-        
+
+        if constexpr (std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value) {
+            if (!(allocator == other.allocator)) {
+                clear();
+                shrink_to_fit();
+            }
+            allocator = other.allocator;
+            node_allocator = other.node_allocator;
+        }
+
+        Node* spare = head;
+        for (Node* node = head; node; node = node->next) {
+            destroy_range(node->elements(), node->num_elements);
+            node->num_elements = 0;
+        }
+        head = tail = nullptr;
+        total_elements_cnt = 0;
+        index.clear();
+
+        clone_from(other, spare);
         return *this;
     }
     
+    // Without propagation, nodes of an unequal allocator cannot be adopted,
+    // so the elements are moved one by one; that is the only case that may throw.
+    unrolled_list& operator=(unrolled_list&& other) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+        std::allocator_traits<Allocator>::is_always_equal::value
+    ) {
+        if (this == &other) {
+            return *this;
+        }
+
+        if constexpr (std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) {
+            if (!(allocator == other.allocator)) {
+                clear();
+                shrink_to_fit();
+            }
+            allocator = other.allocator;
+            node_allocator = other.node_allocator;
+        } else if constexpr (!std::allocator_traits<Allocator>::is_always_equal::value) {
+            if (!(allocator == other.allocator)) {
+                clear();
+                append_sequence(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+                return *this;
+            }
+        }
+
+        clear();
+        steal_nodes(other);
+        return *this;
+    }
+
     unrolled_list& operator=(std::initializer_list<value_type> il) {
         clear();
 
@@ -312,121 +826,133 @@ public:
     }
 
     iterator insert(const_iterator pos, const value_type& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, value_type&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
         Node* current_node = pos.current_node;
         size_t pos_in_node = pos.current_pos;
     
         if (pos == end()) {
-            push_back(value);
+            emplace_back(std::forward<Args>(args)...);
             return iterator(tail, tail->num_elements - 1);
         }
     
         if (current_node->num_elements < NodeMaxSize) {
-            T temp = value;
+            T temp(std::forward<Args>(args)...);
+            return settle(iterator(emplace_in_node(current_node, pos_in_node, temp), pos_in_node));
+        }
     
-            size_t i = current_node->num_elements;
+        // The node is full: the upper half goes straight into a new node and the
+        // new element is built in whichever half it belongs to. Sources are only
+        // destroyed once every relocation succeeded, so a throwing copy leaves
+        // the list unchanged.
+        const size_t split_pos = RebalancePolicy::split_point(NodeMaxSize, current_node == tail);
+        Node* new_node = nullptr;
+
+        if (pos_in_node >= split_pos) {
+            const size_t new_pos = pos_in_node - split_pos;
+            new_node = create_node();
             try {
-                for (; i > pos_in_node; --i) {
-                    current_node->elements[i] = current_node->elements[i - 1];
-                }
+                std::allocator_traits<Allocator>::construct(allocator, new_node->elements() + new_pos,
+                    std::forward<Args>(args)...);
             } catch (...) {
-                for (size_t j = i; j < current_node->num_elements; ++j) {
-                    current_node->elements[j] = current_node->elements[j + 1];
-                }
+                release_node(new_node);
                 throw;
             }
-    
-            current_node->elements[pos_in_node] = temp;
-            current_node->num_elements++;
-            total_elements_cnt++;
-            return iterator(current_node, pos_in_node);
-        }
-    
-        Node* new_node = nullptr;
-        T* temp_buffer = nullptr;
-        try {
-            temp_buffer = static_cast<T*>(::operator new((NodeMaxSize + 1) * sizeof(T)));
-            size_t temp_index = 0;
-    
-            for (size_t i = 0; i < pos_in_node; ++i) {
-                new (&temp_buffer[temp_index++]) T(current_node->elements[i]);
-            }
-    
-            new (&temp_buffer[temp_index++]) T(value);
-    
-            for (size_t i = pos_in_node; i < NodeMaxSize; ++i) {
-                new (&temp_buffer[temp_index++]) T(current_node->elements[i]);
-            }
-    
-            new_node = node_allocator.allocate(1);
-            new_node->num_elements = 0;
-            new_node->prev = new_node->next = nullptr;
-    
-            const size_t split_pos = (NodeMaxSize + 1) / 2;
-    
-            for (size_t i = 0; i < NodeMaxSize; ++i) {
-                current_node->elements[i].~T();
-            }
-    
-            current_node->num_elements = 0;
-            for (size_t i = 0; i < split_pos; ++i) {
-                new (&current_node->elements[current_node->num_elements++]) T(temp_buffer[i]);
-            }
-    
-            for (size_t i = split_pos; i < temp_index; ++i) {
-                new (&new_node->elements[new_node->num_elements++]) T(temp_buffer[i]);
+
+            if constexpr (bitwise_movable) {
+                relocate(new_node->elements(), current_node->elements() + split_pos, new_pos);
+                relocate(new_node->elements() + new_pos + 1, current_node->elements() + pos_in_node,
+                    NodeMaxSize - pos_in_node);
+            } else {
+                size_t i = split_pos;
+                try {
+                    for (; i < NodeMaxSize; ++i) {
+                        std::allocator_traits<Allocator>::construct(allocator,
+                            new_node->elements() + i - split_pos + (i >= pos_in_node),
+                            std::move_if_noexcept(current_node->elements()[i]));
+                    }
+                } catch (...) {
+                    for (size_t j = split_pos; j < i; ++j) {
+                        std::allocator_traits<Allocator>::destroy(allocator,
+                            new_node->elements() + j - split_pos + (j >= pos_in_node));
+                    }
+                    std::allocator_traits<Allocator>::destroy(allocator, new_node->elements() + new_pos);
+                    release_node(new_node);
+                    throw;
+                }
+
+                destroy_range(current_node->elements() + split_pos, NodeMaxSize - split_pos);
+                counters.count(&unrolled_list_stats::element_moves, NodeMaxSize - split_pos);
             }
-    
-            new_node->next = current_node->next;
-            new_node->prev = current_node;
-            if (current_node->next) current_node->next->prev = new_node;
-            current_node->next = new_node;
-            if (current_node == tail) tail = new_node;
-    
+            current_node->num_elements = split_pos;
+            new_node->num_elements = NodeMaxSize + 1 - split_pos;
+            link_after(current_node, new_node);
             total_elements_cnt++;
-    
-            for (size_t i = 0; i < temp_index; ++i) {
-                temp_buffer[i].~T();
-            }
-            ::operator delete(temp_buffer);
-    
-        } catch (...) {
-            if (temp_buffer) {
-                for (size_t i = 0; i < NodeMaxSize + 1; ++i) temp_buffer[i].~T();
-                ::operator delete(temp_buffer);
+        } else {
+            T temp(std::forward<Args>(args)...);
+
+            new_node = create_node();
+            try {
+                relocate(new_node->elements(), current_node->elements() + split_pos - 1,
+                    NodeMaxSize - split_pos + 1);
+            } catch (...) {
+                release_node(new_node);
+                throw;
             }
-            if (new_node) node_allocator.deallocate(new_node, 1);
-            throw;
+            current_node->num_elements = split_pos - 1;
+            new_node->num_elements = NodeMaxSize - split_pos + 1;
+            link_after(current_node, new_node);
+
+            // Past this point a failure keeps the split but not the new element.
+            current_node = emplace_in_node(current_node, pos_in_node, temp);
         }
 
-        const size_t kSplitPos = NodeMaxSize / 2;
+        counters.count(&unrolled_list_stats::splits);
     
-        if (pos_in_node < kSplitPos) {
-            return iterator(current_node, pos_in_node);
+        if (pos_in_node < split_pos) {
+            return settle(iterator(current_node, pos_in_node));
         } else {
-            return iterator(new_node, pos_in_node - kSplitPos);
+            return settle(iterator(new_node, pos_in_node - split_pos));
         }
     }
 
     iterator insert(const_iterator pos, size_type n, const value_type& value) {
-        iterator it = pos;
+        // value may live in this very node, which the insertion shifts
+        const value_type copy(value);
+        auto copies = std::views::iota(size_type{0}, n)
+            | std::views::transform([&copy](size_type) -> const value_type& { return copy; });
+        return insert_sequence(pos, copies.begin(), copies.end());
+    }
 
-        for (size_type i = 0; i < n; ++i) {
-            it = insert(it, value);
-            ++it;
-        }
+    iterator insert(const_iterator pos, std::initializer_list<value_type> il) {
+        return insert_sequence(pos, il.begin(), il.end());
+    }
 
-        return it;
+    template<std::input_iterator InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        return insert_sequence(pos, std::move(first), std::move(last));
     }
 
-    iterator insert(const_iterator pos, std::initializer_list<value_type> il) {
-        iterator it = pos;
+    template<std::ranges::input_range R>
+    iterator insert_range(const_iterator pos, R&& rg) {
+        return insert_sequence(pos, std::ranges::begin(rg), std::ranges::end(rg));
+    }
 
-        for (const auto& item : il) {
-            it = insert(it, item);
-            ++it;
-        }
+    template<std::ranges::input_range R>
+    void append_range(R&& rg) {
+        insert_sequence(end(), std::ranges::begin(rg), std::ranges::end(rg));
+    }
 
-        return it;
+    template<std::ranges::input_range R>
+    void prepend_range(R&& rg) {
+        insert_sequence(begin(), std::ranges::begin(rg), std::ranges::end(rg));
     }
 
     iterator erase(const_iterator pos) {
@@ -437,85 +963,141 @@ public:
         Node* node = pos.current_node;
         size_t pos_in_node = pos.current_pos;
     
-        std::allocator_traits<Allocator>::destroy(allocator, &node->elements[pos_in_node]);
-        for (size_t i = pos_in_node; i < node->num_elements - 1; ++i) {
-            node->elements[i] = std::move(node->elements[i+1]);
-        }
-        --node->num_elements;
+        std::allocator_traits<Allocator>::destroy(allocator, node->elements() + pos_in_node);
+        close_gap(node, pos_in_node);
         --total_elements_cnt;
+        index.update(node);
     
         if (node->num_elements == 0) {
-            if (node->prev) node->prev->next = node->next;
-            if (node->next) node->next->prev = node->prev;
-            if (node == head) head = node->next;
-            if (node == tail) tail = node->prev;
-            destroy_node(node);
-            return iterator(head, 0);
+            Node* next = node->next;
+            unlink_node(node);
+            return settle(iterator(next, 0));
         }
     
-        if (node->num_elements < NodeMaxSize / 2) {
-            if (node->next && node->next->num_elements + node->num_elements <= NodeMaxSize) {
-                merge_with_next(node);
-            } else if (node->prev && node->prev->num_elements + node->num_elements <= NodeMaxSize) {
-                merge_with_prev(node);
-            }
+        Node* result_node = node;
+        if (pos_in_node == node->num_elements) {
+            result_node = node->next;
+            pos_in_node = 0;
         }
+        rebalance(node, result_node, pos_in_node);
     
-        return (pos_in_node < node->num_elements) ? iterator(node, pos_in_node) : iterator(node->next, 0);
+        return settle(iterator(result_node, pos_in_node));
     }
 
+    // Interior nodes are dropped whole, the two boundary nodes are trimmed and
+    // rebalanced once.
     iterator erase(const_iterator first, const_iterator last) {
-        iterator it = first;
+        if (first == last) {
+            return iterator(last.current_node, last.current_pos);
+        }
+
+        Node* first_node = first.current_node;
+        Node* last_node = last.current_node;
+        size_t first_pos = first.current_pos;
+        const size_t last_pos = last.current_pos;
+
+        if (first_node == last_node) {
+            destroy_range(first_node->elements() + first_pos, last_pos - first_pos);
+            close_gap(first_node, first_pos, last_pos - first_pos);
+            total_elements_cnt -= last_pos - first_pos;
+            index.update(first_node);
+
+            if (first_node->num_elements == 0) {
+                Node* next = first_node->next;
+                unlink_node(first_node);
+                return settle(iterator(next, 0));
+            }
 
-        while (it != last) {
-            it = erase(it);
+            Node* result_node = first_node;
+            if (first_pos == first_node->num_elements) {
+                result_node = first_node->next;
+                first_pos = 0;
+            }
+            rebalance(first_node, result_node, first_pos);
+            return settle(iterator(result_node, first_pos));
         }
-        
-        return it;
+
+        size_t removed = first_node->num_elements - first_pos;
+        truncate(first_node, first_pos);
+        index.update(first_node);
+
+        for (Node* node = first_node->next; node != last_node;) {
+            Node* next = node->next;
+            removed += node->num_elements;
+            index.unlink(node);
+            destroy_node(node);
+            node = next;
+        }
+        first_node->next = last_node;
+        if (last_node) last_node->prev = first_node;
+        else tail = first_node;
+
+        if (last_node && last_pos > 0) {
+            destroy_range(last_node->elements(), last_pos);
+            last_node->offset += last_pos;
+            last_node->num_elements -= last_pos;
+            removed += last_pos;
+            index.update(last_node);
+        }
+        total_elements_cnt -= removed;
+
+        Node* result_node = last_node;
+        size_t result_pos = 0;
+        if (first_node->num_elements == 0) {
+            unlink_node(first_node);
+        } else {
+            rebalance(first_node, result_node, result_pos);
+        }
+        if (result_node && result_node == last_node) {
+            rebalance(last_node, result_node, result_pos);
+        }
+
+        return settle(iterator(result_node, result_pos));
     }
 
     reference front() {
-        return head->elements[0];
+        return head->elements()[0];
     }
 
     const_reference front() const {
-        return head->elements[0];
+        return head->elements()[0];
     }
 
     reference back() {
-        return tail->elements[tail->num_elements - 1];
+        return tail->elements()[tail->num_elements - 1];
     }
 
     const_reference back() const {
-        return tail->elements[tail->num_elements - 1];
+        return tail->elements()[tail->num_elements - 1];
     }
 
     void push_front(const value_type& t) {
-        if (head && head->num_elements < NodeMaxSize) {
-            for (size_t i = head->num_elements; i > 0; --i) {
-                std::allocator_traits<Allocator>::construct(allocator, head->elements + i,
-                std::move_if_noexcept(head->elements[i - 1]));
-                std::allocator_traits<Allocator>::destroy(allocator, head->elements + i - 1);
-            }
-            try {
-                std::allocator_traits<Allocator>::construct(allocator, head->elements, t);
-            } catch (...) {
-                for (size_t i = 0; i < head->num_elements; ++i) {
-                    std::allocator_traits<Allocator>::construct(allocator, head->elements + i,
-                        std::move_if_noexcept(head->elements[i + 1]));
-                    std::allocator_traits<Allocator>::destroy(allocator, head->elements + i + 1);
-                }
-                throw;
-            }
-            ++head->num_elements;
-            ++total_elements_cnt;
+        emplace_front(t);
+    }
+
+    void push_front(value_type&& t) {
+        emplace_front(std::move(t));
+    }
+
+    template<typename... Args>
+    reference emplace_front(Args&&... args) {
+        if (head && head->offset == 0 && can_slide(head)) {
+            T temp(std::forward<Args>(args)...);
+
+            slide(head, NodeMaxSize - head->num_elements);
+            std::allocator_traits<Allocator>::construct(allocator, head->elements() - 1, std::move(temp));
+        } else if (head && head->offset > 0) {
+            std::allocator_traits<Allocator>::construct(allocator, head->elements() - 1,
+                std::forward<Args>(args)...);
         } else {
-            Node* new_node = std::allocator_traits<NodeAllocator>::allocate(node_allocator, 1);
+            Node* new_node = allocate_node();
             new_node->num_elements = 0;
+            new_node->offset = NodeMaxSize - 1;
             new_node->next = head;
             new_node->prev = nullptr;
             try {
-                std::allocator_traits<Allocator>::construct(allocator, new_node->elements, t);
+                std::allocator_traits<Allocator>::construct(allocator, new_node->elements(),
+                    std::forward<Args>(args)...);
                 new_node->num_elements = 1;
                 if (head) {
                     head->prev = new_node;
@@ -523,51 +1105,76 @@ public:
                     tail = new_node;
                 }
                 head = new_node;
+                index.link_after(nullptr, new_node);
                 ++total_elements_cnt;
             } catch (...) {
-                std::allocator_traits<NodeAllocator>::deallocate(node_allocator, new_node, 1);
+                release_node(new_node);
                 throw;
             }
+
+            return *settle(begin());
         }
+
+        --head->offset;
+        ++head->num_elements;
+        index.update(head);
+        ++total_elements_cnt;
+        return *settle(begin());
     }
 
     void pop_front() noexcept {
         if (!head) return;
         
-        std::allocator_traits<Allocator>::destroy(allocator, head->elements);
-        for (size_t i = 1; i < head->num_elements; ++i) {
-            std::allocator_traits<Allocator>::construct(allocator, head->elements + i - 1,
-            std::move_if_noexcept(head->elements[i]));
-            std::allocator_traits<Allocator>::destroy(allocator, head->elements + i);
-        }
-        --head->num_elements;
+        std::allocator_traits<Allocator>::destroy(allocator, head->elements());
+        close_gap(head, 0);
         --total_elements_cnt;
+        index.update(head);
         
         if (head->num_elements == 0) {
+            index.unlink(head);
             Node* old_head = head;
             head = head->next;
             if (head) head->prev = nullptr;
             else tail = nullptr;
-            std::allocator_traits<NodeAllocator>::deallocate(node_allocator, old_head, 1);
+            release_node(old_head);
         }
+        settle();
     }
 
     void push_back(const value_type& t) {
-        if (tail && tail->num_elements < NodeMaxSize) {
-            try {
-                std::allocator_traits<Allocator>::construct(allocator, tail->elements + tail->num_elements, t);
-                ++tail->num_elements;
-                ++total_elements_cnt;
-            } catch (...) {
-                throw;
-            }
+        emplace_back(t);
+    }
+
+    void push_back(value_type&& t) {
+        emplace_back(std::move(t));
+    }
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (tail && tail->offset + tail->num_elements == NodeMaxSize && can_slide(tail)) {
+            T temp(std::forward<Args>(args)...);
+
+            slide(tail, 0);
+            std::allocator_traits<Allocator>::construct(allocator, tail->elements() + tail->num_elements,
+                std::move(temp));
+            ++tail->num_elements;
+            index.update(tail);
+            ++total_elements_cnt;
+        } else if (tail && tail->offset + tail->num_elements < NodeMaxSize) {
+            std::allocator_traits<Allocator>::construct(allocator, tail->elements() + tail->num_elements,
+                std::forward<Args>(args)...);
+            ++tail->num_elements;
+            index.update(tail);
+            ++total_elements_cnt;
         } else {
-            Node* new_node = std::allocator_traits<NodeAllocator>::allocate(node_allocator, 1);
+            Node* new_node = allocate_node();
             new_node->num_elements = 0;
+            new_node->offset = 0;
             new_node->prev = tail;
             new_node->next = nullptr;
             try {
-                std::allocator_traits<Allocator>::construct(allocator, new_node->elements, t);
+                std::allocator_traits<Allocator>::construct(allocator, new_node->elements(),
+                    std::forward<Args>(args)...);
 
                 ++new_node->num_elements; 
                 if (tail) {
@@ -575,47 +1182,229 @@ public:
                 } else {
                     head = new_node;
                 }
+                index.link_after(tail, new_node);
                 tail = new_node;
                 ++total_elements_cnt;
             } catch (...) {
-                std::allocator_traits<NodeAllocator>::deallocate(node_allocator, new_node, 1);
+                release_node(new_node);
                 throw;
             }
         }
+
+        return *settle(iterator(tail, tail->num_elements - 1));
     }
 
     void pop_back() noexcept {
         if (!tail) return;
         
         --tail->num_elements;
-        std::allocator_traits<Allocator>::destroy(allocator, tail->elements + tail->num_elements);
+        std::allocator_traits<Allocator>::destroy(allocator, tail->elements() + tail->num_elements);
         --total_elements_cnt;
+        index.update(tail);
         
         if (tail->num_elements == 0) {
+            index.unlink(tail);
             Node* old_tail = tail;
             tail = tail->prev;
             if (tail) tail->next = nullptr;
             else head = nullptr;
-            std::allocator_traits<NodeAllocator>::deallocate(node_allocator, old_tail, 1);
+            release_node(old_tail);
         }
+        settle();
     }
 
     void clear() noexcept {
+        if constexpr (trivially_destroyed) {
+            if (releases_in_bulk()) {
+                forget_nodes();
+                return;
+            }
+        }
+
         Node* current = head;
         while (current != nullptr) {
             Node* next = current->next;
-
-            for (size_t i = 0; i < current->num_elements; ++i) {
-                std::allocator_traits<Allocator>::destroy(allocator, &current->elements[i]);
-            }
-
-            // std::allocator_traits<NodeAllocator>::destroy(node_allocator, current);
-            std::allocator_traits<NodeAllocator>::deallocate(node_allocator, current, 1);
+            destroy_range(current->elements(), current->num_elements);
+            release_node(current);
             current = next;
         }
         tail = nullptr;
         head = nullptr;
         total_elements_cnt = 0;
+        index.clear();
+    }
+
+    // The member algorithms below move elements into the nodes the list already
+    // owns, front to back, so afterwards every node but the last is full. Like
+    // splice, split_at and the compaction calls, they need a T whose move
+    // cannot throw.
+
+    // Removes the matching elements in a single pass and returns their number.
+    // If pred throws, the elements it has not seen yet are kept.
+    template<typename Predicate>
+    size_type remove_if(Predicate pred) requires nothrow_relocatable {
+        return repack_if([&](const T*, T& item) { return pred(item); });
+    }
+
+    // value may refer to an element of the list, so it is compared by copy.
+    size_type remove(const value_type& value) requires nothrow_relocatable {
+        const value_type target(value);
+        return remove_if([&](const T& item) { return item == target; });
+    }
+
+    // Keeps the first element of every run of consecutive elements for which
+    // pred(first, element) holds; returns the number removed.
+    template<typename BinaryPredicate = std::equal_to<>>
+    size_type unique(BinaryPredicate pred = BinaryPredicate()) requires nothrow_relocatable {
+        return repack_if([&](const T* kept, T& item) { return kept && pred(*kept, item); });
+    }
+
+    // Each node is sorted on its own, then runs of nodes are merged pairwise.
+    // If comp throws, the list keeps its size; elements are in unspecified
+    // order, and those std::sort was moving within a node may be moved-from.
+    template<typename Compare = std::less<>>
+    void sort(Compare comp = Compare()) requires nothrow_relocatable {
+        sort_nodes<false>(comp);
+    }
+
+    template<typename Compare = std::less<>>
+    void stable_sort(Compare comp = Compare()) requires nothrow_relocatable {
+        sort_nodes<true>(comp);
+    }
+
+    // Both lists must be sorted by comp and their allocators must compare
+    // equal; other is left empty. Equivalent elements of *this come first.
+    template<typename Compare = std::less<>>
+    void merge(unrolled_list& other, Compare comp = Compare()) requires nothrow_relocatable {
+        if (&other == this || other.total_elements_cnt == 0) {
+            return;
+        }
+
+        // The merge needs up to two nodes beyond those it frees on the way.
+        if (head) {
+            reserve_nodes(2);
+        }
+
+        std::pair<Node*, Node*> merged{other.head, other.tail};
+        const size_type added = other.total_elements_cnt;
+        other.head = other.tail = nullptr;
+        other.compaction_cursor = nullptr;
+        other.total_elements_cnt = 0;
+        other.index.clear();
+
+        std::exception_ptr error;
+        if (head) {
+            const size_type cache_limit = std::exchange(node_cache_max, std::numeric_limits<size_type>::max());
+            merged = merge_runs({head, tail}, merged, comp, error);
+            node_cache_max = cache_limit;
+            trim_node_cache(cache_limit);
+        }
+        total_elements_cnt += added;
+        adopt_chain(merged.first, merged.second);
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    template<typename Compare = std::less<>>
+    void merge(unrolled_list&& other, Compare comp = Compare()) requires nothrow_relocatable {
+        merge(other, comp);
+    }
+
+    // Moves the elements of other before pos by relinking its nodes; only the
+    // node holding pos is split and the nodes at the two seams may be merged.
+    // Iterators into those boundary nodes are invalidated. With allocators
+    // that compare unequal the elements are moved one by one instead.
+    void splice(const_iterator pos, unrolled_list& other) requires nothrow_relocatable {
+        if (&other != this) {
+            splice(pos, other, other.cbegin(), other.cend());
+        }
+    }
+
+    void splice(const_iterator pos, unrolled_list&& other) requires nothrow_relocatable {
+        splice(pos, other);
+    }
+
+    // Moves [first, last) of other before pos; other may be *this as long as
+    // pos is outside the range. Costs O(nodes in the range).
+    void splice(const_iterator pos, unrolled_list& other, const_iterator first, const_iterator last)
+        requires nothrow_relocatable {
+        if (first == last || (&other == this && (pos == first || pos == last))) {
+            return;
+        }
+        if (!(allocator == other.allocator)) {
+            insert(pos, std::make_move_iterator(iterator(first.current_node, first.current_pos)),
+                   std::make_move_iterator(iterator(last.current_node, last.current_pos)));
+            other.erase(first, last);
+            return;
+        }
+
+        Node* first_node;
+        Node* last_node;
+        Node* pos_node;
+        if (&other != this) {
+            last_node = other.cut_before(last);
+            first_node = other.cut_before(first);
+            pos_node = cut_before(pos);
+        } else {
+            // Cutting a node only moves the elements behind the cut, so the
+            // positions are cut from the back of their node first.
+            std::pair<const_iterator, Node**> cuts[] = {{first, &first_node}, {last, &last_node}, {pos, &pos_node}};
+            std::sort(std::begin(cuts), std::end(cuts), [](const auto& lhs, const auto& rhs) {
+                return lhs.first.current_pos > rhs.first.current_pos;
+            });
+            for (auto& [it, node] : cuts) {
+                *node = cut_before(it);
+            }
+        }
+
+        // The cursor of other may be among the nodes leaving it.
+        other.compaction_cursor = nullptr;
+        Node* chain_last = last_node ? last_node->prev : other.tail;
+        size_type moved = 0;
+        for (Node* node = first_node;; node = node->next) {
+            moved += node->num_elements;
+            other.index.unlink(node);
+            if (node == chain_last) {
+                break;
+            }
+        }
+
+        Node* before = first_node->prev;
+        if (before) before->next = last_node;
+        else other.head = last_node;
+        if (last_node) last_node->prev = before;
+        else other.tail = before;
+        other.total_elements_cnt -= moved;
+
+        link_chain(pos_node ? pos_node->prev : tail, first_node, chain_last);
+        total_elements_cnt += moved;
+
+        if (before && last_node) {
+            other.merge_seam(before);
+        }
+        merge_seam(chain_last);
+        if (first_node->prev) {
+            merge_seam(first_node->prev);
+        }
+    }
+
+    void splice(const_iterator pos, unrolled_list&& other, const_iterator first, const_iterator last)
+        requires nothrow_relocatable {
+        splice(pos, other, first, last);
+    }
+
+    // Leaves [begin(), pos) in *this and returns [pos, end()) as a new list
+    // with the same allocator.
+    unrolled_list split_at(const_iterator pos) requires nothrow_relocatable {
+        unrolled_list rest(allocator);
+        rest.splice(rest.cend(), *this, pos, cend());
+        return rest;
+    }
+
+    void append(unrolled_list&& other) requires nothrow_relocatable {
+        splice(cend(), other);
     }
 
     reference at(size_type n) {
@@ -623,7 +1412,8 @@ public:
             throw std::out_of_range("unrolled_list::at");
         }
 
-        return *(begin() + n);
+        auto [node, pos] = locate(n);
+        return node->elements()[pos];
     }
 
     const_reference at(size_type n) const {
@@ -631,7 +1421,56 @@ public:
             throw std::out_of_range("unrolled_list::at");
         }
 
-        return *(begin() + n);
+        auto [node, pos] = locate(n);
+        return node->elements()[pos];
+    }
+
+    reference operator[](size_type n) {
+        auto [node, pos] = locate(n);
+        return node->elements()[pos];
+    }
+
+    const_reference operator[](size_type n) const {
+        auto [node, pos] = locate(n);
+        return node->elements()[pos];
+    }
+
+    iterator nth(size_type n) {
+        if (n >= total_elements_cnt) {
+            return end();
+        }
+
+        auto [node, pos] = locate(n);
+        return iterator(node, pos);
+    }
+
+    const_iterator nth(size_type n) const {
+        if (n >= total_elements_cnt) {
+            return end();
+        }
+
+        auto [node, pos] = locate(n);
+        return const_iterator(node, pos);
+    }
+
+    size_type index_of(const_iterator pos) const noexcept {
+        if (pos.current_node == nullptr) {
+            return total_elements_cnt;
+        }
+
+        if constexpr (IndexPolicy::indexed) {
+            return index.rank(pos.current_node) + pos.current_pos;
+        } else {
+            size_type result = pos.current_pos;
+            for (Node* node = head; node != pos.current_node; node = node->next) {
+                result += node->num_elements;
+            }
+            return result;
+        }
+    }
+
+    difference_type distance(const_iterator first, const_iterator last) const noexcept {
+        return static_cast<difference_type>(index_of(last)) - static_cast<difference_type>(index_of(first));
     }
 
     iterator begin() { 
@@ -658,6 +1497,25 @@ public:
         return end(); 
     }
 
+    segment_range<false> segments() {
+        return segment_range<false>(segment_iterator<false>(head, 0, nullptr, 0));
+    }
+
+    segment_range<true> segments() const {
+        return segment_range<true>(segment_iterator<true>(head, 0, nullptr, 0));
+    }
+
+    // Segments of [first, last); the boundary nodes are clipped.
+    segment_range<false> segments(const_iterator first, const_iterator last) {
+        return segment_range<false>(
+            segment_iterator<false>(first.current_node, first.current_pos, last.current_node, last.current_pos));
+    }
+
+    segment_range<true> segments(const_iterator first, const_iterator last) const {
+        return segment_range<true>(
+            segment_iterator<true>(first.current_node, first.current_pos, last.current_node, last.current_pos));
+    }
+
     reverse_iterator rbegin() { 
         return reverse_iterator(end());
     }
@@ -703,6 +1561,10 @@ public:
         std::swap(head, other.head);
         std::swap(tail, other.tail);
         std::swap(total_elements_cnt, other.total_elements_cnt);
+        std::swap(index, other.index);
+        std::swap(node_cache, other.node_cache);
+        std::swap(cached_nodes_cnt, other.cached_nodes_cnt);
+        std::swap(compaction_cursor, other.compaction_cursor);
         
         if constexpr (std::allocator_traits<NodeAllocator>::propagate_on_container_swap::value) {
             std::swap(node_allocator, other.node_allocator);
@@ -724,31 +1586,1144 @@ public:
         return begin() == end();
     }
 
+    // Makes sure n nodes can be created without calling the allocator.
+    void reserve_nodes(size_type n) {
+        while (cached_nodes_cnt < n) {
+            Node* node = std::allocator_traits<NodeAllocator>::allocate(node_allocator, 1);
+            counters.count(&unrolled_list_stats::node_allocations);
+            node->next = node_cache;
+            node_cache = node;
+            ++cached_nodes_cnt;
+        }
+    }
+
+    // Makes room for n elements in total: whatever does not fit into the free
+    // back of the last node is reserved as cached nodes, so push_back up to
+    // that size does not call the allocator.
+    void reserve(size_type n) {
+        if (n <= total_elements_cnt) {
+            return;
+        }
+        const size_type room = tail ? NodeMaxSize - tail->offset - tail->num_elements : 0;
+        const size_type missing = n - total_elements_cnt - std::min(room, n - total_elements_cnt);
+        reserve_nodes((missing + NodeMaxSize - 1) / NodeMaxSize);
+    }
+
+    // Repacks all elements front to back in one pass so that every node but
+    // the last is full, and releases the nodes left over. Invalidates
+    // iterators.
+    void compact() noexcept requires nothrow_relocatable {
+        pack_nodes();
+    }
+
+    // Compacts, if T allows it, and returns cached nodes to the allocator.
+    void shrink_to_fit() noexcept {
+        if constexpr (nothrow_relocatable) {
+            compact();
+        }
+        trim_node_cache(0);
+    }
+
+    // Nodes holding elements, counted in O(nodes).
+    size_type node_count() const noexcept {
+        size_type count = 0;
+        for (const Node* node = head; node; node = node->next) {
+            ++count;
+        }
+        return count;
+    }
+
+    // Elements that fit into the nodes owned, cached ones included, without
+    // calling the allocator.
+    size_type capacity() const noexcept {
+        return (node_count() + cached_nodes_cnt) * NodeMaxSize;
+    }
+
+    // Packs up to budget nodes, starting where the previous step stopped: a
+    // node merges its successor when both fit in one, or else fills up from
+    // it. The cursor wraps around to the head at the tail. Returns the number
+    // of steps taken, which is less than budget only for an empty list.
+    size_type compact_step(size_type budget) noexcept requires nothrow_relocatable {
+        Node* track_node = nullptr;
+        size_t track_pos = 0;
+        return compact_steps(budget, track_node, track_pos);
+    }
+
+    // Every push, pop, insert and erase then runs compact_step(steps), which
+    // keeps the work per operation bounded; zero turns it off.
+    void set_incremental_compaction(size_type steps) noexcept requires nothrow_relocatable {
+        compaction_steps = steps;
+    }
+
+    size_type incremental_compaction() const noexcept {
+        return compaction_steps;
+    }
+
+    // Share of the slots in linked nodes that hold no element, in [0, 1).
+    double fragmentation() const noexcept {
+        const size_type slots = node_count() * NodeMaxSize;
+        return slots == 0 ? 0.0 : 1.0 - static_cast<double>(total_elements_cnt) / static_cast<double>(slots);
+    }
+
+    unrolled_list_stats stats() const requires StatsPolicy::enabled {
+        unrolled_list_stats result = counters;
+        for (const Node* node = head; node; node = node->next) {
+            const size_t bucket = node->num_elements * unrolled_list_stats::fill_buckets / NodeMaxSize;
+            ++result.fill_histogram[std::min(bucket, unrolled_list_stats::fill_buckets - 1)];
+        }
+        return result;
+    }
+
+    void reset_stats() noexcept requires StatsPolicy::enabled {
+        counters.reset();
+    }
+
+    size_type cached_nodes() const noexcept {
+        return cached_nodes_cnt;
+    }
+
+    size_type node_cache_limit() const noexcept {
+        return node_cache_max;
+    }
+
+    // Freed nodes beyond the limit go back to the allocator; zero disables the cache.
+    void set_node_cache_limit(size_type limit) noexcept {
+        node_cache_max = limit;
+        trim_node_cache(limit);
+    }
+
+    // Compile-time view of how a node is laid out in memory.
+    static constexpr unrolled_list_layout node_layout() noexcept {
+        using Hook = typename IndexPolicy::template hook<Node>;
+        constexpr size_t header = 2 * sizeof(size_t) + 2 * sizeof(Node*) + (std::is_empty_v<Hook> ? 0 : sizeof(Hook));
+        return {
+            sizeof(T),
+            NodeMaxSize,
+            NodeMaxSize * sizeof(T),
+            sizeof(Node),
+            (sizeof(Node) + unrolled_list_cache_line - 1) / unrolled_list_cache_line,
+            header,
+            sizeof(Node) - NodeMaxSize * sizeof(T) - header,
+        };
+    }
+
+    // Walks the nodes once; see dump_layout for a per-node picture.
+    unrolled_list_occupancy occupancy() const noexcept {
+        unrolled_list_occupancy result{};
+        result.cached_nodes = cached_nodes_cnt;
+        result.elements = total_elements_cnt;
+        result.min_fill = head ? NodeMaxSize : 0;
+        for (const Node* node = head; node; node = node->next) {
+            ++result.nodes;
+            result.min_fill = std::min(result.min_fill, node->num_elements);
+            result.max_fill = std::max(result.max_fill, node->num_elements);
+        }
+        if (result.nodes > 0) {
+            result.avg_fill = static_cast<double>(total_elements_cnt) / static_cast<double>(result.nodes);
+        }
+
+        result.bytes_allocated = (result.nodes + result.cached_nodes) * sizeof(Node);
+        result.bytes_live = total_elements_cnt * sizeof(T);
+        result.bytes_wasted = result.bytes_allocated - result.bytes_live;
+        if (result.nodes > 0) {
+            result.wasted_bytes_per_node =
+                static_cast<double>(result.nodes * sizeof(Node) - result.bytes_live) / static_cast<double>(result.nodes);
+        }
+        return result;
+    }
+
+    // Writes the occupancy summary followed by a map with one character per
+    // node, width nodes per line: '#' is a full node, a digit d a node filled
+    // to [d, d + 1) tenths of its capacity.
+    void dump_layout(std::ostream& out, size_t width = 64) const {
+        constexpr unrolled_list_layout layout = node_layout();
+        const unrolled_list_occupancy stats = occupancy();
+        out << "nodes " << stats.nodes << " (+" << stats.cached_nodes << " cached), elements " << stats.elements
+            << ", capacity " << NodeMaxSize << ", fill min/avg/max " << stats.min_fill << '/' << stats.avg_fill
+            << '/' << stats.max_fill << '\n'
+            << "bytes allocated " << stats.bytes_allocated << ", live " << stats.bytes_live << ", wasted "
+            << stats.bytes_wasted << "; per node " << layout.node_bytes << " = " << layout.payload_bytes
+            << " payload + " << layout.header_bytes << " header + " << layout.padding_bytes << " padding\n";
+
+        size_t column = 0;
+        for (const Node* node = head; node; node = node->next) {
+            if (node->num_elements == NodeMaxSize) {
+                out << '#';
+            } else {
+                out << static_cast<char>('0' + node->num_elements * 10 / NodeMaxSize);
+            }
+            if (++column == width) {
+                out << '\n';
+                column = 0;
+            }
+        }
+        if (column > 0) {
+            out << '\n';
+        }
+    }
+
 
 private:
+    // Hops whole nodes from whichever end is closer, so the cost is
+    // O(size() / NodeMaxSize) instead of O(size()). With the node index
+    // it is a treap descent instead.
+    std::pair<Node*, size_type> locate(size_type n) const noexcept {
+        if constexpr (IndexPolicy::indexed) {
+            return index.find(n);
+        }
+
+        if (n < total_elements_cnt / 2) {
+            Node* node = head;
+            while (n >= node->num_elements) {
+                n -= node->num_elements;
+                node = node->next;
+            }
+            return {node, n};
+        }
+
+        Node* node = tail;
+        size_type from_back = total_elements_cnt - n;
+        while (from_back > node->num_elements) {
+            from_back -= node->num_elements;
+            node = node->prev;
+        }
+        return {node, node->num_elements - from_back};
+    }
+
+    // Takes a node from the cache of freed ones before asking the allocator.
+    Node* allocate_node() {
+        if (node_cache) {
+            Node* node = node_cache;
+            node_cache = node->next;
+            --cached_nodes_cnt;
+            counters.count(&unrolled_list_stats::nodes_reused);
+            return node;
+        }
+        Node* node = std::allocator_traits<NodeAllocator>::allocate(node_allocator, 1);
+        counters.count(&unrolled_list_stats::node_allocations);
+        return node;
+    }
+
+    void release_node(Node* node) noexcept {
+        if (node == compaction_cursor) {
+            compaction_cursor = nullptr;
+        }
+        if (cached_nodes_cnt < node_cache_max) {
+            node->next = node_cache;
+            node_cache = node;
+            ++cached_nodes_cnt;
+        } else {
+            std::allocator_traits<NodeAllocator>::deallocate(node_allocator, node, 1);
+            counters.count(&unrolled_list_stats::node_deallocations);
+        }
+    }
+
+    // A monotonic resource only reclaims memory when it is released as a
+    // whole, so handing nodes back to it one by one is wasted work.
+    bool releases_in_bulk() const noexcept {
+        if constexpr (std::is_same_v<Allocator, std::pmr::polymorphic_allocator<T>>) {
+            return dynamic_cast<std::pmr::monotonic_buffer_resource*>(allocator.resource()) != nullptr;
+        } else {
+            return false;
+        }
+    }
+
+    // Drops every node, cached ones included, without touching them.
+    void forget_nodes() noexcept {
+        head = nullptr;
+        tail = nullptr;
+        total_elements_cnt = 0;
+        index.clear();
+        node_cache = nullptr;
+        cached_nodes_cnt = 0;
+        compaction_cursor = nullptr;
+    }
+
+    void trim_node_cache(size_type keep) noexcept {
+        while (cached_nodes_cnt > keep) {
+            Node* next = node_cache->next;
+            std::allocator_traits<NodeAllocator>::deallocate(node_allocator, node_cache, 1);
+            counters.count(&unrolled_list_stats::node_deallocations);
+            node_cache = next;
+            --cached_nodes_cnt;
+        }
+    }
+
     Node* create_node() {
-        Node* node = node_allocator.allocate(1);
+        Node* node = allocate_node();
         node->prev = node->next = nullptr;
         node->num_elements = 0;
+        node->offset = 0;
         return node;
     }
 
+    // Links a node whose num_elements is already set right after pos.
+    void link_after(Node* pos, Node* node) noexcept {
+        node->prev = pos;
+        node->next = pos->next;
+        if (pos->next) pos->next->prev = node;
+        else tail = node;
+        pos->next = node;
+        index.update(pos);
+        index.link_after(pos, node);
+    }
+
+    // Move-constructs [src, src + count) into raw storage at dst, then destroys
+    // the sources. If a copy throws, the sources are left untouched.
+    void relocate(T* dst, T* src, size_t count) {
+        counters.count(&unrolled_list_stats::element_moves, count);
+        if constexpr (bitwise_movable) {
+            if (count > 0) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+            }
+            return;
+        }
+
+        size_t i = 0;
+        try {
+            for (; i < count; ++i) {
+                std::allocator_traits<Allocator>::construct(allocator, dst + i, std::move_if_noexcept(src[i]));
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                std::allocator_traits<Allocator>::destroy(allocator, dst + j);
+            }
+            throw;
+        }
+
+        destroy_range(src, count);
+    }
+
+    // Like relocate, but the ranges may overlap and the move must not throw.
+    void shift(T* dst, T* src, size_t count) noexcept {
+        counters.count(&unrolled_list_stats::element_moves, count);
+        if constexpr (bitwise_movable) {
+            if (count > 0) {
+                std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+            }
+        } else if (dst < src) {
+            for (size_t i = 0; i < count; ++i) {
+                std::allocator_traits<Allocator>::construct(allocator, dst + i, std::move_if_noexcept(src[i]));
+                std::allocator_traits<Allocator>::destroy(allocator, src + i);
+            }
+        } else if (dst > src) {
+            for (size_t i = count; i > 0; --i) {
+                std::allocator_traits<Allocator>::construct(allocator, dst + i - 1,
+                    std::move_if_noexcept(src[i - 1]));
+                std::allocator_traits<Allocator>::destroy(allocator, src + i - 1);
+            }
+        }
+    }
+
+    void destroy_range(T* first, size_t count) noexcept {
+        if constexpr (!trivially_destroyed) {
+            for (size_t i = 0; i < count; ++i) {
+                std::allocator_traits<Allocator>::destroy(allocator, first + i);
+            }
+        }
+    }
+
+    // Bulk insertion. A range that fits into the target node is inserted with a
+    // single shift; anything larger is first built into a detached chain of
+    // packed nodes, so a throwing constructor leaves the list untouched, and the
+    // chain is then spliced in after splitting the target node once.
+    template<typename It, typename Sent>
+    iterator insert_sequence(const_iterator pos, It first, Sent last) {
+        if (first == last) {
+            return iterator(pos.current_node, pos.current_pos);
+        }
+
+        if (pos.current_node == nullptr) {
+            return settle(append_sequence(std::move(first), std::move(last)));
+        }
+
+        Node* node = pos.current_node;
+        const size_t at = pos.current_pos;
+
+        if constexpr (std::forward_iterator<It> && std::is_nothrow_move_constructible_v<T>) {
+            const size_t count = static_cast<size_t>(std::ranges::distance(first, last));
+            if (count <= NodeMaxSize - node->num_elements) {
+                insert_into_node(node, at, first, count);
+                return settle(iterator(node, at));
+            }
+        }
+
+        auto [chain_head, chain_tail, count] = build_chain(first, last);
+        Node* before = node->prev;
+
+        if (at > 0) {
+            const size_t moved = node->num_elements - at;
+            try {
+                if (chain_tail->num_elements + moved > NodeMaxSize) {
+                    Node* rest = create_node();
+                    rest->prev = chain_tail;
+                    chain_tail->next = rest;
+                    chain_tail = rest;
+                }
+                relocate(chain_tail->elements() + chain_tail->num_elements, node->elements() + at, moved);
+            } catch (...) {
+                destroy_chain(chain_head);
+                throw;
+            }
+            chain_tail->num_elements += moved;
+            node->num_elements = at;
+            index.update(node);
+            counters.count(&unrolled_list_stats::splits);
+            before = node;
+        }
+
+        link_chain(before, chain_head, chain_tail);
+        total_elements_cnt += count;
+        return settle(iterator(chain_head, 0));
+    }
+
+    template<typename It, typename Sent>
+    iterator append_sequence(It first, Sent last) {
+        Node* old_tail = tail;
+        const size_t old_size = tail ? tail->num_elements : 0;
+
+        if (tail && tail->offset + tail->num_elements < NodeMaxSize) {
+            try {
+                for (; first != last && tail->offset + tail->num_elements < NodeMaxSize; ++first) {
+                    std::allocator_traits<Allocator>::construct(allocator,
+                        tail->elements() + tail->num_elements, *first);
+                    ++tail->num_elements;
+                }
+            } catch (...) {
+                truncate(tail, old_size);
+                throw;
+            }
+        }
+
+        Node* chain_head = nullptr;
+        Node* chain_tail = nullptr;
+        size_t count = 0;
+        if (first != last) {
+            try {
+                std::tie(chain_head, chain_tail, count) = build_chain(first, last);
+            } catch (...) {
+                if (old_tail) truncate(old_tail, old_size);
+                throw;
+            }
+        }
+
+        if (old_tail) {
+            total_elements_cnt += old_tail->num_elements - old_size;
+            index.update(old_tail);
+        }
+        if (chain_head) {
+            link_chain(tail, chain_head, chain_tail);
+            total_elements_cnt += count;
+        }
+
+        if (old_tail && old_tail->num_elements > old_size) {
+            return iterator(old_tail, old_size);
+        }
+        return iterator(chain_head, 0);
+    }
+
+    template<typename It>
+    void insert_into_node(Node* node, size_t at, It& first, size_t count) {
+        if (node->offset + node->num_elements + count > NodeMaxSize) {
+            slide(node, 0);
+        }
+
+        T* base = node->elements();
+        shift(base + at + count, base + at, node->num_elements - at);
+
+        size_t k = 0;
+        try {
+            for (; k < count; ++k, ++first) {
+                std::allocator_traits<Allocator>::construct(allocator, base + at + k, *first);
+            }
+        } catch (...) {
+            destroy_range(base + at, k);
+            shift(base + at, base + at + count, node->num_elements - at);
+            throw;
+        }
+
+        node->num_elements += count;
+        index.update(node);
+        total_elements_cnt += count;
+    }
+
+    // Builds a detached chain of packed nodes. On failure everything built so
+    // far is destroyed and nothing else is touched.
+    template<typename It, typename Sent>
+    std::tuple<Node*, Node*, size_t> build_chain(It& first, Sent& last) {
+        Node* chain_head = nullptr;
+        Node* chain_tail = nullptr;
+        size_t count = 0;
+
+        try {
+            while (first != last) {
+                Node* node = create_node();
+                node->prev = chain_tail;
+                if (chain_tail) chain_tail->next = node;
+                else chain_head = node;
+                chain_tail = node;
+
+                for (; first != last && node->num_elements < NodeMaxSize; ++first) {
+                    std::allocator_traits<Allocator>::construct(allocator,
+                        node->elements() + node->num_elements, *first);
+                    ++node->num_elements;
+                    ++count;
+                }
+            }
+        } catch (...) {
+            destroy_chain(chain_head);
+            throw;
+        }
+
+        return {chain_head, chain_tail, count};
+    }
+
+    // Links the detached chain [first, last] right after before (nullptr means
+    // at the front).
+    void link_chain(Node* before, Node* first, Node* last) noexcept {
+        Node* after = before ? before->next : head;
+        first->prev = before;
+        last->next = after;
+        if (before) before->next = first;
+        else head = first;
+        if (after) after->prev = last;
+        else tail = last;
+
+        for (Node* node = first; node != after; node = node->next) {
+            index.link_after(node->prev, node);
+        }
+    }
+
+    void destroy_chain(Node* node) noexcept {
+        while (node) {
+            Node* next = node->next;
+            destroy_node(node);
+            node = next;
+        }
+    }
+
+    // Destroys elements from the back of node until count remain.
+    void truncate(Node* node, size_t count) noexcept {
+        destroy_range(node->elements() + count, node->num_elements - count);
+        node->num_elements = count;
+    }
+
+    // Opens a raw slot at pos and counts it in num_elements. Elements are shifted
+    // towards whichever end of the node is closer and has room.
+    void open_gap(Node* node, size_t pos) {
+        const bool room_front = node->offset > 0;
+        const bool room_back = node->offset + node->num_elements < NodeMaxSize;
+
+        if constexpr (bitwise_movable) {
+            if (room_front && (pos < node->num_elements / 2 || !room_back)) {
+                shift(node->elements() - 1, node->elements(), pos);
+                --node->offset;
+            } else {
+                shift(node->elements() + pos + 1, node->elements() + pos, node->num_elements - pos);
+            }
+            ++node->num_elements;
+            return;
+        }
+
+        if (room_front && (pos < node->num_elements / 2 || !room_back)) {
+            counters.count(&unrolled_list_stats::element_moves, pos);
+            T* first = node->elements();
+            size_t i = 0;
+            try {
+                for (; i < pos; ++i) {
+                    std::allocator_traits<Allocator>::construct(allocator, first + i - 1,
+                        std::move_if_noexcept(first[i]));
+                    std::allocator_traits<Allocator>::destroy(allocator, first + i);
+                }
+            } catch (...) {
+                while (i-- > 0) {
+                    std::allocator_traits<Allocator>::construct(allocator, first + i,
+                        std::move_if_noexcept(first[i - 1]));
+                    std::allocator_traits<Allocator>::destroy(allocator, first + i - 1);
+                }
+                throw;
+            }
+            --node->offset;
+        } else {
+            counters.count(&unrolled_list_stats::element_moves, node->num_elements - pos);
+            size_t i = node->num_elements;
+            try {
+                for (; i > pos; --i) {
+                    std::allocator_traits<Allocator>::construct(allocator, node->elements() + i,
+                        std::move_if_noexcept(node->elements()[i - 1]));
+                    std::allocator_traits<Allocator>::destroy(allocator, node->elements() + i - 1);
+                }
+            } catch (...) {
+                for (++i; i <= node->num_elements; ++i) {
+                    std::allocator_traits<Allocator>::construct(allocator, node->elements() + i - 1,
+                        std::move_if_noexcept(node->elements()[i]));
+                    std::allocator_traits<Allocator>::destroy(allocator, node->elements() + i);
+                }
+                throw;
+            }
+        }
+        ++node->num_elements;
+    }
+
+    // Moves value into pos of a node with a free slot and returns the node
+    // that holds it. A gap can only be closed again if moving T cannot throw;
+    // otherwise the elements and value are copied into a fresh node that
+    // replaces node once every copy has succeeded.
+    Node* emplace_in_node(Node* node, size_t pos, T& value) {
+        if constexpr (std::is_nothrow_move_constructible_v<T>) {
+            open_gap(node, pos);
+            try {
+                std::allocator_traits<Allocator>::construct(allocator, node->elements() + pos, std::move(value));
+            } catch (...) {
+                close_gap(node, pos);
+                throw;
+            }
+            index.update(node);
+            ++total_elements_cnt;
+            return node;
+        } else {
+            Node* fresh = create_node();
+            T* dst = fresh->elements();
+            const size_t count = node->num_elements + 1;
+            size_t built = 0;
+            try {
+                for (; built < count; ++built) {
+                    T& src = built == pos ? value : node->elements()[built - (built > pos)];
+                    std::allocator_traits<Allocator>::construct(allocator, dst + built, std::move_if_noexcept(src));
+                }
+            } catch (...) {
+                destroy_range(dst, built);
+                release_node(fresh);
+                throw;
+            }
+            counters.count(&unrolled_list_stats::element_moves, count - 1);
+
+            fresh->num_elements = count;
+            link_after(node, fresh);
+            destroy_range(node->elements(), node->num_elements);
+            node->num_elements = 0;
+            unlink_node(node);
+            ++total_elements_cnt;
+            return fresh;
+        }
+    }
+
+    // Inverse of open_gap: [pos, pos + count) is raw storage and the shorter
+    // side moves over it.
+    void close_gap(Node* node, size_t pos, size_t count = 1) noexcept {
+        T* first = node->elements();
+        if (pos < node->num_elements - pos - count) {
+            shift(first + count, first, pos);
+            node->offset += count;
+        } else {
+            shift(first + pos, first + pos + count, node->num_elements - pos - count);
+        }
+        node->num_elements -= count;
+    }
+
+    // Sliding a node pays for itself only when it frees at least half of it.
+    static bool can_slide(const Node* node) noexcept {
+        return std::is_nothrow_move_constructible_v<T> && node->num_elements <= NodeMaxSize / 2;
+    }
+
+    void slide(Node* node, size_t new_offset) noexcept {
+        shift(node->slots() + new_offset, node->elements(), node->num_elements);
+        node->offset = new_offset;
+    }
+
     void destroy_node(Node* node) noexcept {
-        for (size_t i = 0; i < node->num_elements; ++i) {
-            std::allocator_traits<Allocator>::destroy(allocator, &node->elements[i]);
+        destroy_range(node->elements(), node->num_elements);
+        release_node(node);
+    }
+
+    // Detaches an empty node from the list and the index and frees it.
+    void unlink_node(Node* node) noexcept {
+        if (node->prev) node->prev->next = node->next;
+        else head = node->next;
+        if (node->next) node->next->prev = node->prev;
+        else tail = node->prev;
+        index.unlink(node);
+        destroy_node(node);
+    }
+
+    // Merges a node that fell below the policy's minimum fill into a neighbour,
+    // or borrows from the fuller neighbour when no merge fits and the policy
+    // allows it. (track_node, track_pos) is an element position that is kept
+    // valid across the move.
+    void rebalance(Node* node, Node*& track_node, size_t& track_pos) noexcept {
+        if (node->num_elements >= RebalancePolicy::min_fill(NodeMaxSize)) {
+            return;
+        }
+
+        if (node->next && node->next->num_elements + node->num_elements <= NodeMaxSize) {
+            if (track_node == node->next) {
+                track_node = node;
+                track_pos += node->num_elements;
+            }
+            merge_with_next(node);
+        } else if (node->prev && node->prev->num_elements + node->num_elements <= NodeMaxSize) {
+            if (track_node == node) {
+                track_node = node->prev;
+                track_pos += node->prev->num_elements;
+            }
+            merge_with_prev(node);
+        } else if constexpr (RebalancePolicy::borrow) {
+            const size_t next_size = node->next ? node->next->num_elements : 0;
+            const size_t prev_size = node->prev ? node->prev->num_elements : 0;
+            if (next_size >= prev_size && next_size > node->num_elements + 1) {
+                borrow_from_next(node, (next_size - node->num_elements) / 2, track_node, track_pos);
+            } else if (prev_size > node->num_elements + 1) {
+                borrow_from_prev(node, (prev_size - node->num_elements) / 2, track_node, track_pos);
+            }
+        }
+    }
+
+    // Moves the first count elements of node->next to the back of node.
+    void borrow_from_next(Node* node, size_t count, Node*& track_node, size_t& track_pos) noexcept {
+        counters.count(&unrolled_list_stats::borrows);
+        Node* next_node = node->next;
+        if (node->offset + node->num_elements + count > NodeMaxSize) {
+            slide(node, 0);
         }
-        node_allocator.deallocate(node, 1);
+
+        shift(node->elements() + node->num_elements, next_node->elements(), count);
+
+        if (track_node == next_node) {
+            if (track_pos < count) {
+                track_node = node;
+                track_pos += node->num_elements;
+            } else {
+                track_pos -= count;
+            }
+        }
+
+        node->num_elements += count;
+        next_node->offset += count;
+        next_node->num_elements -= count;
+        index.update(node);
+        index.update(next_node);
+    }
+
+    // Moves the last count elements of node->prev to the front of node.
+    void borrow_from_prev(Node* node, size_t count, Node*& track_node, size_t& track_pos) noexcept {
+        counters.count(&unrolled_list_stats::borrows);
+        Node* prev_node = node->prev;
+        if (node->offset < count) {
+            slide(node, NodeMaxSize - node->num_elements);
+        }
+
+        const size_t keep = prev_node->num_elements - count;
+        shift(node->elements() - count, prev_node->elements() + keep, count);
+
+        if (track_node == node) {
+            track_pos += count;
+        } else if (track_node == prev_node && track_pos >= keep) {
+            track_node = node;
+            track_pos -= keep;
+        }
+
+        node->offset -= count;
+        node->num_elements += count;
+        prev_node->num_elements = keep;
+        index.update(node);
+        index.update(prev_node);
     }
 
     void merge_with_next(Node* node) {
+        counters.count(&unrolled_list_stats::merges);
         Node* next_node = node->next;
-        for (size_t i = 0; i < next_node->num_elements; ++i) {
-            node->elements[node->num_elements++] = std::move(next_node->elements[i]);
+        if (node->offset + node->num_elements + next_node->num_elements > NodeMaxSize) {
+            slide(node, 0);
         }
+        shift(node->elements() + node->num_elements, next_node->elements(), next_node->num_elements);
+        node->num_elements += next_node->num_elements;
         node->next = next_node->next;
         if (next_node->next) next_node->next->prev = node;
         else tail = node;
-        destroy_node(next_node);
+        index.update(node);
+        index.unlink(next_node);
+        // The elements were moved out, only the memory is left.
+        release_node(next_node);
+    }
+
+    void merge_with_prev(Node* node) {
+        merge_with_next(node->prev);
+    }
+
+    // Moves the node chain of other into this empty list. Cached nodes stay
+    // with their owner.
+    void steal_nodes(unrolled_list& other) noexcept {
+        head = std::exchange(other.head, nullptr);
+        tail = std::exchange(other.tail, nullptr);
+        total_elements_cnt = std::exchange(other.total_elements_cnt, 0);
+        compaction_cursor = std::exchange(other.compaction_cursor, nullptr);
+        std::swap(index, other.index);
+        other.index.clear();
+    }
+
+    // Rebuilds the empty list as a node-by-node copy of other, keeping every
+    // node's fill and offset. Nodes come from spare, a chain of nodes without
+    // elements linked through next, before the cache; unused ones are
+    // released. If a copy throws, the list stays empty.
+    void clone_from(const unrolled_list& other, Node* spare) {
+        Node* first = nullptr;
+        Node* last = nullptr;
+        try {
+            for (Node* from = other.head; from; from = from->next) {
+                Node* node = spare;
+                if (node) {
+                    spare = spare->next;
+                } else {
+                    node = allocate_node();
+                }
+                node->next = nullptr;
+                node->offset = from->offset;
+                node->num_elements = 0;
+                if (last) last->next = node;
+                else first = node;
+                last = node;
+
+                copy_elements(node->elements(), from->elements(), from->num_elements);
+                node->num_elements = from->num_elements;
+            }
+        } catch (...) {
+            destroy_chain(first);
+            destroy_chain(spare);
+            throw;
+        }
+
+        destroy_chain(spare);
+        total_elements_cnt = other.total_elements_cnt;
+        adopt_chain(first, last);
+    }
+
+    // Copy-constructs [src, src + count) into raw storage at dst. If a copy
+    // throws, nothing is left constructed.
+    void copy_elements(T* dst, const T* src, size_t count) {
+        if constexpr (bitwise_movable) {
+            if (count > 0) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+            }
+            return;
+        }
+
+        size_t i = 0;
+        try {
+            for (; i < count; ++i) {
+                std::allocator_traits<Allocator>::construct(allocator, dst + i, src[i]);
+            }
+        } catch (...) {
+            destroy_range(dst, i);
+            throw;
+        }
+    }
+
+    size_type compact_steps(size_type budget, Node*& track_node, size_t& track_pos) noexcept {
+        size_type steps = 0;
+        for (; steps < budget && head; ++steps) {
+            Node* node = compaction_cursor ? compaction_cursor : head;
+            Node* next_node = node->next;
+            if (!next_node) {
+                compaction_cursor = nullptr;
+            } else if (node->num_elements + next_node->num_elements <= NodeMaxSize) {
+                if (track_node == next_node) {
+                    track_node = node;
+                    track_pos += node->num_elements;
+                }
+                // The cursor stays: node may take more from its new successor.
+                compaction_cursor = node;
+                merge_with_next(node);
+            } else {
+                if (node->num_elements < NodeMaxSize) {
+                    borrow_from_next(node, NodeMaxSize - node->num_elements, track_node, track_pos);
+                }
+                compaction_cursor = next_node;
+            }
+        }
+        return steps;
+    }
+
+    // Runs the incremental compaction steps at the end of an operation and
+    // keeps it pointing to the same element. Operations that build an element
+    // from arguments run them only afterwards, as the arguments may refer to
+    // elements the steps move.
+    iterator settle(iterator it) noexcept {
+        if (compaction_steps > 0) {
+            compact_steps(compaction_steps, it.current_node, it.current_pos);
+        }
+        return it;
+    }
+
+    void settle() noexcept {
+        if (compaction_steps > 0) {
+            compact_step(compaction_steps);
+        }
+    }
+
+    // Splits the node of it so that it is the first element of a node, and
+    // returns that node, or nullptr for end().
+    Node* cut_before(const_iterator it) {
+        Node* node = it.current_node;
+        if (!node || it.current_pos == 0) {
+            return node;
+        }
+
+        Node* fresh = create_node();
+        const size_t count = node->num_elements - it.current_pos;
+        shift(fresh->slots(), node->elements() + it.current_pos, count);
+        fresh->num_elements = count;
+        node->num_elements = it.current_pos;
+        link_after(node, fresh);
+        counters.count(&unrolled_list_stats::splits);
+        return fresh;
+    }
+
+    // Merges node with its successor when both fit in one node and either is
+    // below the policy's minimum fill.
+    void merge_seam(Node* node) noexcept {
+        Node* next_node = node->next;
+        if (next_node && node->num_elements + next_node->num_elements <= NodeMaxSize &&
+            std::min(node->num_elements, next_node->num_elements) < RebalancePolicy::min_fill(NodeMaxSize)) {
+            merge_with_next(node);
+        }
+    }
+
+    // Moves every element drop(last_kept, item) rejects to the front-most free
+    // slot and releases the nodes left empty. last_kept is the last element
+    // kept so far, or nullptr. Once drop throws, the rest is kept and the
+    // exception is rethrown at the end.
+    template<typename Drop>
+    size_type repack_if(Drop drop) {
+        Node* writer = head;
+        size_t filled = 0;
+        const T* last_kept = nullptr;
+        size_type removed = 0;
+        std::exception_ptr error;
+
+        // The writer never passes the reader, and it only rewrites the counters
+        // of a node once that node has been read.
+        for (Node* node = head; node; node = node->next) {
+            T* item = node->elements();
+            T* const end = item + node->num_elements;
+            for (; item != end; ++item) {
+                bool dropped = false;
+                if (!error) {
+                    try {
+                        dropped = drop(last_kept, *item);
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                }
+                if (dropped) {
+                    destroy_range(item, 1);
+                    ++removed;
+                    continue;
+                }
+
+                if (filled == NodeMaxSize) {
+                    writer->offset = 0;
+                    writer->num_elements = NodeMaxSize;
+                    writer = writer->next;
+                    filled = 0;
+                }
+                T* slot = writer->slots() + filled++;
+                shift(slot, item, 1);
+                last_kept = slot;
+            }
+        }
+
+        total_elements_cnt -= removed;
+        finish_packing(writer, filled);
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return removed;
+    }
+
+    // repack_if that keeps everything, moving whole runs at a time.
+    void pack_nodes() noexcept {
+        Node* writer = head;
+        size_t filled = 0;
+        for (Node* node = head; node; node = node->next) {
+            T* from = node->elements();
+            size_t left = node->num_elements;
+            while (left > 0) {
+                if (filled == NodeMaxSize) {
+                    writer->offset = 0;
+                    writer->num_elements = NodeMaxSize;
+                    writer = writer->next;
+                    filled = 0;
+                }
+                const size_t count = std::min(left, NodeMaxSize - filled);
+                T* to = writer->slots() + filled;
+                if (to != from) {
+                    shift(to, from, count);
+                }
+                from += count;
+                left -= count;
+                filled += count;
+            }
+        }
+        finish_packing(writer, filled);
+    }
+
+    // Ends a packing pass: writer holds the last filled elements, and the
+    // nodes after it have been emptied and are released.
+    void finish_packing(Node* writer, size_t filled) noexcept {
+        Node* rest = head;
+        if (filled > 0) {
+            writer->offset = 0;
+            writer->num_elements = filled;
+            rest = writer->next;
+            writer->next = nullptr;
+            tail = writer;
+        } else {
+            head = tail = nullptr;
+        }
+        while (rest) {
+            Node* next = rest->next;
+            release_node(rest);
+            rest = next;
+        }
+        index.rebuild(head);
+    }
+
+    template<bool Stable, typename Compare>
+    void sort_nodes(Compare& comp) {
+        if (total_elements_cnt < 2) {
+            return;
+        }
+
+        pack_nodes();
+        for (Node* node = head; node; node = node->next) {
+            if constexpr (Stable) {
+                std::stable_sort(node->elements(), node->elements() + node->num_elements, comp);
+            } else {
+                std::sort(node->elements(), node->elements() + node->num_elements, comp);
+            }
+        }
+        if (head == tail) {
+            return;
+        }
+
+        std::vector<std::pair<Node*, Node*>> runs;
+        for (Node* node = head; node; node = node->next) {
+            runs.emplace_back(node, node);
+        }
+        reserve_nodes(2);
+
+        for (auto& run : runs) {
+            run.second->next = nullptr;
+        }
+        const size_type cache_limit = std::exchange(node_cache_max, std::numeric_limits<size_type>::max());
+        std::exception_ptr error;
+        while (runs.size() > 1 && !error) {
+            size_t merged = 0;
+            size_t i = 0;
+            for (; i + 1 < runs.size() && !error; i += 2) {
+                runs[merged++] = merge_runs(runs[i], runs[i + 1], comp, error);
+            }
+            for (; i < runs.size(); ++i) {
+                runs[merged++] = runs[i];
+            }
+            runs.resize(merged);
+        }
+        node_cache_max = cache_limit;
+        trim_node_cache(cache_limit);
+
+        for (size_t i = 0; i + 1 < runs.size(); ++i) {
+            runs[i].second->next = runs[i + 1].first;
+        }
+        adopt_chain(runs.front().first, runs.back().second);
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Merges two detached runs sorted by comp into a run of packed nodes, taking
+    // nodes from the cache and releasing the input ones as they empty; at most
+    // two more nodes than the inputs free are needed. Runs already in order are
+    // just chained. Once comp throws, the rest is moved over unmerged and the
+    // exception is stored in error.
+    template<typename Compare>
+    std::pair<Node*, Node*> merge_runs(std::pair<Node*, Node*> left, std::pair<Node*, Node*> right,
+                                       Compare& comp, std::exception_ptr& error) noexcept {
+        try {
+            const Node* last = left.second;
+            if (!comp(*right.first->elements(), last->elements()[last->num_elements - 1])) {
+                left.second->next = right.first;
+                return {left.first, right.second};
+            }
+        } catch (...) {
+            error = std::current_exception();
+            left.second->next = right.first;
+            return {left.first, right.second};
+        }
+
+        Node* first = nullptr;
+        Node* out = nullptr;
+        size_t filled = NodeMaxSize;
+        const auto take = [&](Node*& node, size_t& pos) noexcept {
+            if (filled == NodeMaxSize) {
+                Node* fresh = create_node();
+                if (out) {
+                    out->num_elements = NodeMaxSize;
+                    out->next = fresh;
+                } else {
+                    first = fresh;
+                }
+                out = fresh;
+                filled = 0;
+            }
+            shift(out->slots() + filled++, node->elements() + pos++, 1);
+            if (pos == node->num_elements) {
+                Node* next = node->next;
+                release_node(node);
+                node = next;
+                pos = 0;
+            }
+        };
+
+        Node* a = left.first;
+        Node* b = right.first;
+        size_t a_pos = 0;
+        size_t b_pos = 0;
+        while (a && b) {
+            bool from_b = false;
+            try {
+                from_b = comp(b->elements()[b_pos], a->elements()[a_pos]);
+            } catch (...) {
+                error = std::current_exception();
+                break;
+            }
+            if (from_b) {
+                take(b, b_pos);
+            } else {
+                take(a, a_pos);
+            }
+        }
+        while (a) {
+            take(a, a_pos);
+        }
+        while (b) {
+            take(b, b_pos);
+        }
+        out->num_elements = filled;
+        return {first, out};
+    }
+
+    // Makes a detached chain linked through next the whole list.
+    void adopt_chain(Node* first, Node* last) noexcept {
+        head = first;
+        tail = last;
+        compaction_cursor = nullptr;
+        Node* prev = nullptr;
+        for (Node* node = first; node; prev = node, node = node->next) {
+            node->prev = prev;
+        }
+        index.rebuild(head);
     }
 };
 
@@ -763,14 +2738,35 @@ private:
 //     return lhs.operator<=>(rhs);
 // }
 
-template<typename T, size_t NodeMaxSize, typename Allocator>
-bool operator==( const unrolled_list<T, NodeMaxSize, Allocator>& lhs, 
-                 const unrolled_list<T, NodeMaxSize, Allocator>& rhs ) {
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies>
+bool operator==( const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& lhs, 
+                 const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& rhs ) {
     return lhs.operator==(rhs);
 }
 
-template<typename T, size_t NodeMaxSize, typename Allocator>
-void swap( unrolled_list<T, NodeMaxSize, Allocator>& lhs, 
-           unrolled_list<T, NodeMaxSize, Allocator>& rhs ) {
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies>
+void swap( unrolled_list<T, NodeMaxSize, Allocator, Policies...>& lhs, 
+           unrolled_list<T, NodeMaxSize, Allocator, Policies...>& rhs ) {
     lhs.swap(rhs);
 }
+
+// A list whose nodes take about Bytes bytes each.
+template<typename T, size_t Bytes, typename Allocator = std::allocator<T>,
+         typename IndexPolicy = unrolled_list_no_index,
+         typename RebalancePolicy = unrolled_list_default_rebalance,
+         typename StatsPolicy = unrolled_list_no_stats>
+using unrolled_list_bytes =
+    unrolled_list<T, unrolled_list_capacity_for_bytes<T, Bytes>, Allocator, IndexPolicy, RebalancePolicy, StatsPolicy>;
+
+// True when every node of List fits in Bytes, meant for static_assert.
+template<typename List, size_t Bytes>
+inline constexpr bool unrolled_list_node_fits = List::node_layout().node_bytes <= Bytes;
+
+// Not std::pmr: adding declarations to namespace std is undefined behaviour,
+// and a global pmr namespace would clash with std::pmr under using namespace std.
+template<typename T, size_t NodeMaxSize = unrolled_list_capacity_for_bytes<T, unrolled_list_default_node_bytes>,
+         typename IndexPolicy = unrolled_list_no_index,
+         typename RebalancePolicy = unrolled_list_default_rebalance,
+         typename StatsPolicy = unrolled_list_no_stats>
+using unrolled_list_pmr =
+    unrolled_list<T, NodeMaxSize, std::pmr::polymorphic_allocator<T>, IndexPolicy, RebalancePolicy, StatsPolicy>;
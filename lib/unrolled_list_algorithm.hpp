@@ -0,0 +1,110 @@
+#pragma once
+
+#include "unrolled_list.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <utility>
+
+// Algorithms that run one tight loop per node instead of going through the
+// element iterator, whose increment has to check for the end of the node on
+// every step. They are found by argument-dependent lookup on unrolled_list.
+
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies, typename Function>
+Function for_each(unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Function f) {
+    for (auto segment : list.segments()) {
+        for (auto& item : segment) {
+            f(item);
+        }
+    }
+    return f;
+}
+
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies, typename Function>
+Function for_each(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Function f) {
+    for (auto segment : list.segments()) {
+        for (auto& item : segment) {
+            f(item);
+        }
+    }
+    return f;
+}
+
+template<typename List, typename Predicate>
+auto unrolled_list_find_if_segments(List& list, Predicate pred) {
+    auto segments = list.segments();
+    for (auto it = segments.begin(); it != segments.end(); ++it) {
+        const auto segment = *it;
+        const auto found = std::find_if(segment.begin(), segment.end(), pred);
+        if (found != segment.end()) {
+            return it.element(static_cast<size_t>(found - segment.begin()));
+        }
+    }
+    return list.end();
+}
+
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies, typename U>
+auto find(unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, const U& value) {
+    return unrolled_list_find_if_segments(list, [&value](const T& item) { return item == value; });
+}
+
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies, typename U>
+auto find(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, const U& value) {
+    return unrolled_list_find_if_segments(list, [&value](const T& item) { return item == value; });
+}
+
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies, typename Predicate>
+auto find_if(unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Predicate pred) {
+    return unrolled_list_find_if_segments(list, std::move(pred));
+}
+
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies, typename Predicate>
+auto find_if(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Predicate pred) {
+    return unrolled_list_find_if_segments(list, std::move(pred));
+}
+
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies, typename U>
+size_t count(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, const U& value) {
+    size_t result = 0;
+    for (auto segment : list.segments()) {
+        result += static_cast<size_t>(std::count(segment.begin(), segment.end(), value));
+    }
+    return result;
+}
+
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies, typename Predicate>
+size_t count_if(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Predicate pred) {
+    size_t result = 0;
+    for (auto segment : list.segments()) {
+        result += static_cast<size_t>(std::count_if(segment.begin(), segment.end(), pred));
+    }
+    return result;
+}
+
+// With a pointer as the destination each node becomes a single memmove for
+// trivially copyable types.
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies, typename OutputIt>
+OutputIt copy(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, OutputIt out) {
+    for (auto segment : list.segments()) {
+        out = std::copy(segment.begin(), segment.end(), out);
+    }
+    return out;
+}
+
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies, typename U>
+void fill(unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, const U& value) {
+    for (auto segment : list.segments()) {
+        std::fill(segment.begin(), segment.end(), value);
+    }
+}
+
+template<typename T, size_t NodeMaxSize, typename Allocator, typename... Policies, typename Init,
+         typename BinaryOp = std::plus<>>
+Init accumulate(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Init init,
+                BinaryOp op = BinaryOp()) {
+    for (auto segment : list.segments()) {
+        init = std::accumulate(segment.begin(), segment.end(), std::move(init), op);
+    }
+    return init;
+}
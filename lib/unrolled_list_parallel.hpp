@@ -0,0 +1,265 @@
+#pragma once
+
+#include "unrolled_list.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Execution-policy overloads of for_each, transform, reduce, count_if and sort.
+// The list is cut into runs of whole nodes with about the same number of
+// elements and every run is handed to its own thread as a set of spans, so no
+// list iterator is shared between threads. Threads are started per call; lists
+// too small to pay for that, and the seq and unseq policies, run in the
+// calling thread. The first exception thrown by any run is rethrown once all
+// runs have finished.
+
+namespace unrolled_list_parallel {
+
+// Below this many elements per thread starting a thread costs more than it saves.
+inline constexpr size_t min_elements_per_thread = size_t{1} << 14;
+
+template<typename Policy>
+concept execution_policy = std::is_execution_policy_v<std::remove_cvref_t<Policy>>;
+
+// unseq only allows vectorization, so like seq it must stay in the calling thread.
+template<typename Policy>
+constexpr bool sequenced = std::is_same_v<std::remove_cvref_t<Policy>, std::execution::sequenced_policy>
+    || std::is_same_v<std::remove_cvref_t<Policy>, std::execution::unsequenced_policy>;
+
+template<typename Span>
+struct partition {
+    std::span<const Span> segments;
+    // Index of the first element of the run within the whole list.
+    size_t offset;
+};
+
+template<typename Policy, typename List>
+auto split(List& list) {
+    using Span = std::ranges::range_value_t<decltype(list.segments())>;
+
+    size_t parts = 1;
+    if constexpr (!sequenced<Policy>) {
+        const size_t threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        parts = std::clamp<size_t>(list.size() / min_elements_per_thread, 1, threads);
+    }
+
+    std::vector<Span> segments;
+    for (auto segment : list.segments()) {
+        segments.push_back(segment);
+    }
+
+    std::vector<partition<Span>> result;
+    result.reserve(parts);
+    const size_t target = (list.size() + parts - 1) / std::max<size_t>(parts, 1);
+    size_t first = 0;
+    size_t offset = 0;
+    size_t filled = 0;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        filled += segments[i].size();
+        if (filled >= target || i + 1 == segments.size()) {
+            result.push_back({std::span<const Span>(segments.data() + first, i + 1 - first), offset});
+            offset += filled;
+            filled = 0;
+            first = i + 1;
+        }
+    }
+    return std::pair(std::move(segments), std::move(result));
+}
+
+// Runs f(i) for every i in [0, count), one thread each except the last, which
+// runs in the caller.
+template<typename F>
+void run(size_t count, F f) {
+    if (count == 0) {
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(count);
+    std::vector<std::thread> threads;
+    threads.reserve(count - 1);
+
+    const auto guarded = [&](size_t i) {
+        try {
+            f(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    try {
+        for (size_t i = 0; i + 1 < count; ++i) {
+            threads.emplace_back(guarded, i);
+        }
+    } catch (...) {
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        throw;
+    }
+    guarded(count - 1);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // namespace unrolled_list_parallel
+
+template<unrolled_list_parallel::execution_policy Policy, typename T, size_t NodeMaxSize, typename Allocator,
+         typename... Policies, typename Function>
+void for_each(Policy&&, unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Function f) {
+    const auto [segments, parts] = unrolled_list_parallel::split<Policy>(list);
+    unrolled_list_parallel::run(parts.size(), [&](size_t i) {
+        Function local = f;
+        for (auto segment : parts[i].segments) {
+            for (auto& item : segment) {
+                local(item);
+            }
+        }
+    });
+}
+
+template<unrolled_list_parallel::execution_policy Policy, typename T, size_t NodeMaxSize, typename Allocator,
+         typename... Policies, typename Function>
+void for_each(Policy&&, const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Function f) {
+    const auto [segments, parts] = unrolled_list_parallel::split<Policy>(list);
+    unrolled_list_parallel::run(parts.size(), [&](size_t i) {
+        Function local = f;
+        for (auto segment : parts[i].segments) {
+            for (const auto& item : segment) {
+                local(item);
+            }
+        }
+    });
+}
+
+// Writes op(e) for the i-th element e to out[i]; returns out + size().
+template<unrolled_list_parallel::execution_policy Policy, typename T, size_t NodeMaxSize, typename Allocator,
+         typename... Policies, std::random_access_iterator OutputIt, typename UnaryOp>
+OutputIt transform(Policy&&, const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, OutputIt out,
+                   UnaryOp op) {
+    const auto [segments, parts] = unrolled_list_parallel::split<Policy>(list);
+    unrolled_list_parallel::run(parts.size(), [&](size_t i) {
+        OutputIt to = out + static_cast<std::iter_difference_t<OutputIt>>(parts[i].offset);
+        for (auto segment : parts[i].segments) {
+            to = std::transform(segment.begin(), segment.end(), to, op);
+        }
+    });
+    return out + static_cast<std::iter_difference_t<OutputIt>>(list.size());
+}
+
+// op must be associative and commutative, as for std::reduce.
+template<unrolled_list_parallel::execution_policy Policy, typename T, size_t NodeMaxSize, typename Allocator,
+         typename... Policies, typename Init, typename BinaryOp = std::plus<>>
+Init reduce(Policy&&, const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Init init,
+            BinaryOp op = BinaryOp()) {
+    const auto [segments, parts] = unrolled_list_parallel::split<Policy>(list);
+    std::vector<std::optional<Init>> partial(parts.size());
+    unrolled_list_parallel::run(parts.size(), [&](size_t i) {
+        auto segment = parts[i].segments.begin();
+        Init result = Init((*segment)[0]);
+        for (auto it = segment->begin() + 1; it != segment->end(); ++it) {
+            result = op(std::move(result), *it);
+        }
+        for (++segment; segment != parts[i].segments.end(); ++segment) {
+            for (const auto& item : *segment) {
+                result = op(std::move(result), item);
+            }
+        }
+        partial[i] = std::move(result);
+    });
+
+    for (auto& value : partial) {
+        init = op(std::move(init), std::move(*value));
+    }
+    return init;
+}
+
+template<unrolled_list_parallel::execution_policy Policy, typename T, size_t NodeMaxSize, typename Allocator,
+         typename... Policies, typename Predicate>
+size_t count_if(Policy&&, const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Predicate pred) {
+    const auto [segments, parts] = unrolled_list_parallel::split<Policy>(list);
+    std::vector<size_t> partial(parts.size());
+    unrolled_list_parallel::run(parts.size(), [&](size_t i) {
+        for (auto segment : parts[i].segments) {
+            partial[i] += static_cast<size_t>(std::count_if(segment.begin(), segment.end(), pred));
+        }
+    });
+    return std::accumulate(partial.begin(), partial.end(), size_t{0});
+}
+
+// Elements are moved out into a buffer, sorted in runs that are then merged
+// pairwise, and moved back into the same nodes, so the node layout does not
+// change. If comp throws, the list keeps all its elements in unspecified order.
+template<unrolled_list_parallel::execution_policy Policy, typename T, size_t NodeMaxSize, typename Allocator,
+         typename... Policies, typename Compare = std::less<>>
+void sort(Policy&&, unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Compare comp = Compare()) {
+    const auto [segments, parts] = unrolled_list_parallel::split<Policy>(list);
+    if (parts.empty()) {
+        return;
+    }
+
+    std::vector<T> buffer;
+    buffer.reserve(list.size());
+    for (auto segment : segments) {
+        std::move(segment.begin(), segment.end(), std::back_inserter(buffer));
+    }
+
+    const auto move_back = [&](size_t i) {
+        auto from = buffer.begin() + static_cast<ptrdiff_t>(parts[i].offset);
+        for (auto segment : parts[i].segments) {
+            const auto to = from + static_cast<ptrdiff_t>(segment.size());
+            std::move(from, to, segment.begin());
+            from = to;
+        }
+    };
+
+    try {
+        std::vector<size_t> bounds;
+        for (const auto& part : parts) {
+            bounds.push_back(part.offset);
+        }
+        bounds.push_back(buffer.size());
+
+        unrolled_list_parallel::run(parts.size(), [&](size_t i) {
+            std::sort(buffer.begin() + static_cast<ptrdiff_t>(bounds[i]),
+                      buffer.begin() + static_cast<ptrdiff_t>(bounds[i + 1]), comp);
+        });
+
+        for (size_t width = 1; width < parts.size(); width *= 2) {
+            const size_t merges = (parts.size() + 2 * width - 1) / (2 * width);
+            unrolled_list_parallel::run(merges, [&](size_t m) {
+                const size_t left = m * 2 * width;
+                const size_t middle = std::min(left + width, parts.size());
+                const size_t right = std::min(left + 2 * width, parts.size());
+                if (middle < right) {
+                    std::inplace_merge(buffer.begin() + static_cast<ptrdiff_t>(bounds[left]),
+                                       buffer.begin() + static_cast<ptrdiff_t>(bounds[middle]),
+                                       buffer.begin() + static_cast<ptrdiff_t>(bounds[right]), comp);
+                }
+            });
+        }
+    } catch (...) {
+        for (size_t i = 0; i < parts.size(); ++i) {
+            move_back(i);
+        }
+        throw;
+    }
+
+    unrolled_list_parallel::run(parts.size(), move_back);
+}
@@ -0,0 +1,413 @@
+#pragma once
+
+#include "unrolled_list.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <type_traits>
+
+// Vectorized scans over node payloads for int32/int64/float/double. Every node
+// is a contiguous run, so each one is handed to a kernel built for the widest
+// instruction set the CPU reports at run time. Float sums are reassociated and
+// may differ from a sequential sum in the last bits.
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__clang__)
+#define UNROLLED_LIST_SIMD_X86 1
+#else
+#define UNROLLED_LIST_SIMD_X86 0
+#endif
+
+namespace unrolled_list_simd {
+
+enum class isa {
+    scalar,
+    sse,
+    avx2,
+    avx512,
+};
+
+inline isa detect_isa() noexcept {
+#if UNROLLED_LIST_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return isa::avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return isa::avx2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return isa::sse;
+    }
+#endif
+    return isa::scalar;
+}
+
+inline isa best_isa() noexcept {
+    static const isa level = detect_isa();
+    return level;
+}
+
+template<typename T>
+concept element = std::same_as<T, int32_t> || std::same_as<T, int64_t> ||
+                  std::same_as<T, float> || std::same_as<T, double>;
+
+enum class comparison {
+    less,
+    less_equal,
+    greater,
+    greater_equal,
+    equal,
+    not_equal,
+};
+
+template<typename Compare>
+struct comparison_of;
+
+template<typename T>
+struct comparison_of<std::less<T>> : std::integral_constant<comparison, comparison::less> {};
+
+template<typename T>
+struct comparison_of<std::less_equal<T>> : std::integral_constant<comparison, comparison::less_equal> {};
+
+template<typename T>
+struct comparison_of<std::greater<T>> : std::integral_constant<comparison, comparison::greater> {};
+
+template<typename T>
+struct comparison_of<std::greater_equal<T>> : std::integral_constant<comparison, comparison::greater_equal> {};
+
+template<typename T>
+struct comparison_of<std::equal_to<T>> : std::integral_constant<comparison, comparison::equal> {};
+
+template<typename T>
+struct comparison_of<std::not_equal_to<T>> : std::integral_constant<comparison, comparison::not_equal> {};
+
+template<typename Compare>
+concept standard_comparison = requires { comparison_of<Compare>::value; };
+
+namespace kernel {
+
+// Bytes is the vector width; 0 selects the plain loops. The vector kernels are
+// always inlined into the per-ISA entry points below, which is what gets them
+// compiled for that instruction set, and they only pass pointers and scalars
+// so no vector crosses a call boundary.
+
+// Integers are summed as unsigned so overflow wraps instead of being undefined.
+template<typename T>
+using accumulator = typename std::conditional_t<std::is_integral_v<T>, std::make_unsigned<T>,
+                                                std::type_identity<T>>::type;
+
+// Writes the result through out, so a vector mask is never returned by value.
+template<comparison Op, typename A, typename R>
+[[gnu::always_inline]] inline void compare(const A& a, const A& b, R& out) {
+    if constexpr (Op == comparison::less) {
+        out = a < b;
+    } else if constexpr (Op == comparison::less_equal) {
+        out = a <= b;
+    } else if constexpr (Op == comparison::greater) {
+        out = a > b;
+    } else if constexpr (Op == comparison::greater_equal) {
+        out = a >= b;
+    } else if constexpr (Op == comparison::equal) {
+        out = a == b;
+    } else {
+        out = a != b;
+    }
+}
+
+template<typename T, size_t Bytes>
+struct vector;
+
+#if UNROLLED_LIST_SIMD_X86
+template<typename T, size_t Bytes>
+struct vector {
+    typedef T type __attribute__((vector_size(Bytes)));
+};
+#endif
+
+template<typename T, size_t Bytes>
+[[gnu::always_inline]] inline size_t find(const T* data, size_t n, T value) noexcept {
+    size_t i = 0;
+    if constexpr (Bytes > 0) {
+        using V = typename vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        constexpr size_t block = 4 * lanes;
+        const V needle = V{} + value;
+        // Masks of a whole block are merged before the lanes are inspected;
+        // on a hit the scalar loop below pinpoints it.
+        for (; i + block <= n; i += block) {
+            V a;
+            V b;
+            V c;
+            V d;
+            __builtin_memcpy(&a, data + i, sizeof(V));
+            __builtin_memcpy(&b, data + i + lanes, sizeof(V));
+            __builtin_memcpy(&c, data + i + 2 * lanes, sizeof(V));
+            __builtin_memcpy(&d, data + i + 3 * lanes, sizeof(V));
+            const auto hit = (a == needle) | (b == needle) | (c == needle) | (d == needle);
+            uint64_t words[sizeof(hit) / sizeof(uint64_t)];
+            __builtin_memcpy(words, &hit, sizeof(hit));
+            uint64_t any = 0;
+            for (uint64_t word : words) {
+                any |= word;
+            }
+            if (any != 0) {
+                break;
+            }
+        }
+    }
+    for (; i < n; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return n;
+}
+
+template<typename T, size_t Bytes, comparison Op>
+[[gnu::always_inline]] inline size_t count_if(const T* data, size_t n, T value) noexcept {
+    size_t i = 0;
+    size_t result = 0;
+    if constexpr (Bytes > 0) {
+        using V = typename vector<T, Bytes>::type;
+        using M = decltype(V{} < V{});
+        constexpr size_t lanes = Bytes / sizeof(T);
+        const V operand = V{} + value;
+        // Matching lanes are -1, so the counters go down.
+        M counters = {};
+        for (; i + lanes <= n; i += lanes) {
+            V v;
+            __builtin_memcpy(&v, data + i, sizeof(V));
+            M hit;
+            compare<Op>(v, operand, hit);
+            counters += hit;
+        }
+        for (size_t l = 0; l < lanes; ++l) {
+            result -= static_cast<size_t>(static_cast<int64_t>(counters[l]));
+        }
+    }
+    for (; i < n; ++i) {
+        bool hit;
+        compare<Op>(data[i], value, hit);
+        result += hit ? 1 : 0;
+    }
+    return result;
+}
+
+template<typename T, size_t Bytes>
+[[gnu::always_inline]] inline T sum(const T* data, size_t n) noexcept {
+    using A = accumulator<T>;
+    size_t i = 0;
+    A result = 0;
+    if constexpr (Bytes > 0) {
+        using V = typename vector<A, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        V first = {};
+        V second = {};
+        for (; i + 2 * lanes <= n; i += 2 * lanes) {
+            V a;
+            V b;
+            __builtin_memcpy(&a, data + i, sizeof(V));
+            __builtin_memcpy(&b, data + i + lanes, sizeof(V));
+            first += a;
+            second += b;
+        }
+        first += second;
+        for (size_t l = 0; l < lanes; ++l) {
+            result += first[l];
+        }
+    }
+    for (; i < n; ++i) {
+        result += static_cast<A>(data[i]);
+    }
+    return static_cast<T>(result);
+}
+
+// Smallest (Less) or largest element of a non-empty run.
+template<typename T, size_t Bytes, bool Less>
+[[gnu::always_inline]] inline T extremum(const T* data, size_t n) noexcept {
+    size_t i = 0;
+    T result = data[0];
+    if constexpr (Bytes > 0) {
+        using V = typename vector<T, Bytes>::type;
+        constexpr size_t lanes = Bytes / sizeof(T);
+        if (n >= lanes) {
+            V best;
+            __builtin_memcpy(&best, data, sizeof(V));
+            for (i = lanes; i + lanes <= n; i += lanes) {
+                V v;
+                __builtin_memcpy(&v, data + i, sizeof(V));
+                best = (Less ? v < best : v > best) ? v : best;
+            }
+            result = best[0];
+            for (size_t l = 1; l < lanes; ++l) {
+                result = (Less ? best[l] < result : best[l] > result) ? best[l] : result;
+            }
+        }
+    }
+    for (; i < n; ++i) {
+        result = (Less ? data[i] < result : data[i] > result) ? data[i] : result;
+    }
+    return result;
+}
+
+// find stays at 32-byte vectors under AVX-512: turning a 64-byte compare mask
+// back into a vector for the early-exit test costs more than the wider load saves.
+#define UNROLLED_LIST_SIMD_ENTRY_POINTS(SUFFIX, TARGET, BYTES)                                   \
+    template<typename T>                                                                          \
+    [[gnu::target(TARGET)]] size_t find_##SUFFIX(const T* data, size_t n, T value) noexcept {     \
+        return find<T, (BYTES > 32 ? 32 : BYTES)>(data, n, value);                                \
+    }                                                                                             \
+    template<typename T, comparison Op>                                                           \
+    [[gnu::target(TARGET)]] size_t count_if_##SUFFIX(const T* data, size_t n, T value) noexcept { \
+        return count_if<T, BYTES, Op>(data, n, value);                                            \
+    }                                                                                             \
+    template<typename T>                                                                          \
+    [[gnu::target(TARGET)]] T sum_##SUFFIX(const T* data, size_t n) noexcept {                    \
+        return sum<T, BYTES>(data, n);                                                            \
+    }                                                                                             \
+    template<typename T, bool Less>                                                               \
+    [[gnu::target(TARGET)]] T extremum_##SUFFIX(const T* data, size_t n) noexcept {               \
+        return extremum<T, BYTES, Less>(data, n);                                                 \
+    }
+
+#if UNROLLED_LIST_SIMD_X86
+UNROLLED_LIST_SIMD_ENTRY_POINTS(sse, "sse4.2", 16)
+UNROLLED_LIST_SIMD_ENTRY_POINTS(avx2, "avx2", 32)
+UNROLLED_LIST_SIMD_ENTRY_POINTS(avx512, "avx512f", 64)
+#endif
+
+#undef UNROLLED_LIST_SIMD_ENTRY_POINTS
+
+#if UNROLLED_LIST_SIMD_X86
+#define UNROLLED_LIST_SIMD_DISPATCH(level, NAME, ARGS, ...)                          \
+    switch (level) {                                                                 \
+        case isa::avx512: return NAME##_avx512<__VA_ARGS__> ARGS;                    \
+        case isa::avx2: return NAME##_avx2<__VA_ARGS__> ARGS;                        \
+        case isa::sse: return NAME##_sse<__VA_ARGS__> ARGS;                          \
+        default: break;                                                              \
+    }
+#else
+#define UNROLLED_LIST_SIMD_DISPATCH(level, NAME, ARGS, ...)
+#endif
+
+template<typename T>
+size_t find(isa level, const T* data, size_t n, T value) noexcept {
+    UNROLLED_LIST_SIMD_DISPATCH(level, find, (data, n, value), T)
+    return find<T, 0>(data, n, value);
+}
+
+template<typename T, comparison Op>
+size_t count_if(isa level, const T* data, size_t n, T value) noexcept {
+    UNROLLED_LIST_SIMD_DISPATCH(level, count_if, (data, n, value), T, Op)
+    return count_if<T, 0, Op>(data, n, value);
+}
+
+template<typename T>
+T sum(isa level, const T* data, size_t n) noexcept {
+    UNROLLED_LIST_SIMD_DISPATCH(level, sum, (data, n), T)
+    return sum<T, 0>(data, n);
+}
+
+template<typename T, bool Less>
+T extremum(isa level, const T* data, size_t n) noexcept {
+    UNROLLED_LIST_SIMD_DISPATCH(level, extremum, (data, n), T, Less)
+    return extremum<T, 0, Less>(data, n);
+}
+
+#undef UNROLLED_LIST_SIMD_DISPATCH
+
+} // namespace kernel
+
+// Requests for an instruction set the CPU lacks fall back to the best one it has.
+inline isa usable(isa level) noexcept {
+    return std::min(level, best_isa());
+}
+
+template<element T, size_t NodeMaxSize, typename Allocator, typename... Policies>
+auto find(unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, T value, isa level = best_isa()) {
+    level = usable(level);
+    auto segments = list.segments();
+    for (auto it = segments.begin(); it != segments.end(); ++it) {
+        const auto segment = *it;
+        const size_t found = kernel::find(level, segment.data(), segment.size(), value);
+        if (found != segment.size()) {
+            return it.element(found);
+        }
+    }
+    return list.end();
+}
+
+template<element T, size_t NodeMaxSize, typename Allocator, typename... Policies>
+auto find(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, T value, isa level = best_isa()) {
+    level = usable(level);
+    auto segments = list.segments();
+    for (auto it = segments.begin(); it != segments.end(); ++it) {
+        const auto segment = *it;
+        const size_t found = kernel::find(level, segment.data(), segment.size(), value);
+        if (found != segment.size()) {
+            return it.element(found);
+        }
+    }
+    return list.end();
+}
+
+// Counts elements e for which compare(e, value) holds; Compare is one of the
+// std comparison function objects.
+template<element T, size_t NodeMaxSize, typename Allocator, typename... Policies, standard_comparison Compare>
+size_t count_if(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, Compare, T value,
+                isa level = best_isa()) {
+    level = usable(level);
+    size_t result = 0;
+    for (auto segment : list.segments()) {
+        result += kernel::count_if<T, comparison_of<Compare>::value>(level, segment.data(), segment.size(), value);
+    }
+    return result;
+}
+
+template<element T, size_t NodeMaxSize, typename Allocator, typename... Policies>
+size_t count(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, T value, isa level = best_isa()) {
+    return count_if(list, std::equal_to<>(), value, level);
+}
+
+template<element T, size_t NodeMaxSize, typename Allocator, typename... Policies>
+T sum(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, isa level = best_isa()) {
+    using A = kernel::accumulator<T>;
+    level = usable(level);
+    A result = 0;
+    for (auto segment : list.segments()) {
+        result += static_cast<A>(kernel::sum(level, segment.data(), segment.size()));
+    }
+    return static_cast<T>(result);
+}
+
+template<element T, size_t NodeMaxSize, typename Allocator, typename... Policies>
+std::optional<T> min(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, isa level = best_isa()) {
+    if (list.size() == 0) {
+        return std::nullopt;
+    }
+    level = usable(level);
+    T result = list.front();
+    for (auto segment : list.segments()) {
+        result = std::min(result, kernel::extremum<T, true>(level, segment.data(), segment.size()));
+    }
+    return result;
+}
+
+template<element T, size_t NodeMaxSize, typename Allocator, typename... Policies>
+std::optional<T> max(const unrolled_list<T, NodeMaxSize, Allocator, Policies...>& list, isa level = best_isa()) {
+    if (list.size() == 0) {
+        return std::nullopt;
+    }
+    level = usable(level);
+    T result = list.front();
+    for (auto segment : list.segments()) {
+        result = std::max(result, kernel::extremum<T, false>(level, segment.data(), segment.size()));
+    }
+    return result;
+}
+
+} // namespace unrolled_list_simd
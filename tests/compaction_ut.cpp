@@ -0,0 +1,288 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "counting_allocator.hpp"
+
+/*
+    Тесты на compact, shrink_to_fit, reserve, node_count и capacity.
+    После перемешанных вставок и удалений ноды заполнены частично,
+    после компактизации все ноды, кроме последней, должны быть полными
+*/
+
+namespace {
+
+using Counts = AllocatorCounters<CountingAllocatorTag>;
+
+template<typename List, typename Expected>
+void Churn(List& list, Expected& expected, unsigned seed) {
+    std::mt19937 rng(seed);
+    for (int step = 0; step < 4000; ++step) {
+        if (expected.size() < 50 || rng() % 3 != 0) {
+            const size_t pos = rng() % (expected.size() + 1);
+            list.insert(list.nth(pos), std::to_string(step));
+            expected.insert(expected.begin() + pos, std::to_string(step));
+        } else {
+            const size_t pos = rng() % expected.size();
+            list.erase(list.nth(pos));
+            expected.erase(expected.begin() + pos);
+        }
+    }
+}
+
+} // namespace
+
+TEST(Compaction, compactPacksNodes) {
+    unrolled_list<std::string, 16, std::allocator<std::string>, unrolled_list_node_index> list;
+    std::vector<std::string> expected;
+    Churn(list, expected, 1);
+
+    const size_t before = list.node_count();
+    list.compact();
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+    ASSERT_EQ(list.node_count(), (expected.size() + 15) / 16);
+    ASSERT_LT(list.node_count(), before);
+    for (size_t i = 0; i < expected.size(); i += 11) {
+        ASSERT_EQ(list[i], expected[i]);
+    }
+
+    list.push_back("x");
+    list.push_front("y");
+    ASSERT_EQ(list.size(), expected.size() + 2);
+}
+
+TEST(Compaction, shrinkToFitReleasesMemory) {
+    using List = unrolled_list<std::string, 8, CountingAllocator<std::string>>;
+    Counts::Live = 0;
+    {
+        List list;
+        std::vector<std::string> expected;
+        Churn(list, expected, 2);
+
+        list.shrink_to_fit();
+        ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+        ASSERT_EQ(list.cached_nodes(), 0);
+        ASSERT_EQ(Counts::Live, static_cast<long>((expected.size() + 7) / 8));
+        ASSERT_EQ(list.capacity(), list.node_count() * 8);
+        ASSERT_GE(list.capacity(), list.size());
+        ASSERT_LT(list.capacity(), list.size() + 8);
+    }
+    ASSERT_EQ(Counts::Live, 0);
+}
+
+TEST(Compaction, emptyAndPackedLists) {
+    unrolled_list<int, 4> list;
+    list.compact();
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.node_count(), 0);
+
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    list.compact();
+    list.compact();
+    ASSERT_THAT(list, ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+    ASSERT_EQ(list.node_count(), 3);
+}
+
+TEST(Compaction, reserveAvoidsAllocations) {
+    using List = unrolled_list<int, 8, CountingAllocator<int>>;
+    List list;
+    list.push_back(0);
+    list.push_back(1);
+    list.push_back(2);
+
+    list.reserve(1000);
+    ASSERT_GE(list.capacity(), 1000);
+
+    Counts::Allocations = 0;
+    for (int i = 3; i < 1000; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(Counts::Allocations, 0);
+    ASSERT_EQ(list.size(), 1000);
+
+    list.reserve(10);
+    ASSERT_EQ(Counts::Allocations, 0);
+}
+
+TEST(Compaction, stepsPayDownFragmentation) {
+    unrolled_list<std::string, 16, std::allocator<std::string>, unrolled_list_node_index> list;
+    std::vector<std::string> expected;
+    Churn(list, expected, 3);
+
+    const double before = list.fragmentation();
+    ASSERT_GT(before, 0.2);
+
+    size_t steps = 0;
+    while (list.node_count() > (expected.size() + 15) / 16) {
+        ASSERT_EQ(list.compact_step(4), 4);
+        steps += 4;
+        ASSERT_LT(steps, 10000);
+    }
+    ASSERT_LT(list.fragmentation(), before);
+    ASSERT_LT(list.fragmentation(), 1.0 / 16 + 1e-9);
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+    for (size_t i = 0; i < expected.size(); i += 7) {
+        ASSERT_EQ(list[i], expected[i]);
+    }
+
+    unrolled_list<int, 4> empty;
+    ASSERT_EQ(empty.compact_step(10), 0);
+    ASSERT_EQ(empty.fragmentation(), 0.0);
+}
+
+TEST(Compaction, incrementalModeKeepsIteratorsValid) {
+    unrolled_list<std::string, 8> list;
+    list.set_incremental_compaction(2);
+    ASSERT_EQ(list.incremental_compaction(), 2);
+
+    std::vector<std::string> expected;
+    std::mt19937 rng(4);
+    for (int step = 0; step < 6000; ++step) {
+        const int op = static_cast<int>(rng() % 7);
+        if (expected.size() < 20 || op < 3) {
+            const size_t pos = rng() % (expected.size() + 1);
+            auto it = list.insert(list.nth(pos), std::to_string(step));
+            ASSERT_EQ(*it, std::to_string(step));
+            expected.insert(expected.begin() + pos, std::to_string(step));
+        } else if (op == 3) {
+            const size_t pos = rng() % expected.size();
+            auto it = list.erase(list.nth(pos));
+            expected.erase(expected.begin() + pos);
+            ASSERT_EQ(it == list.end(), pos == expected.size());
+            if (it != list.end()) {
+                ASSERT_EQ(*it, expected[pos]);
+            }
+        } else if (op == 4) {
+            const size_t from = rng() % expected.size();
+            const size_t to = std::min(expected.size(), from + rng() % 3);
+            auto it = list.erase(list.nth(from), list.nth(to));
+            expected.erase(expected.begin() + from, expected.begin() + to);
+            if (from < expected.size()) {
+                ASSERT_EQ(*it, expected[from]);
+            }
+        } else if (op == 5) {
+            std::string& back = list.emplace_back(std::to_string(-step));
+            ASSERT_EQ(back, std::to_string(-step));
+            expected.push_back(back);
+            list.pop_front();
+            expected.erase(expected.begin());
+        } else {
+            list.push_front(std::to_string(step));
+            expected.insert(expected.begin(), std::to_string(step));
+            list.pop_back();
+            expected.pop_back();
+        }
+    }
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+    // Без компактизации эта нагрузка оставляет незанятыми около 30% слотов
+    ASSERT_LT(list.fragmentation(), 0.15) << list.fragmentation();
+}
+
+TEST(Compaction, cursorSurvivesStructuralChanges) {
+    unrolled_list<int, 4> list;
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+        list.push_front(-i);
+    }
+    for (int i = 0; i < 60; ++i) {
+        list.erase(list.nth((i * 7) % list.size()));
+    }
+    list.compact_step(5);
+
+    auto rest = list.split_at(list.nth(list.size() / 2));
+    list.compact_step(5);
+    rest.compact_step(5);
+    list.clear();
+    list.compact_step(5);
+    rest.sort();
+    rest.compact_step(5);
+    ASSERT_TRUE(std::is_sorted(rest.begin(), rest.end()));
+
+    unrolled_list<int, 4> other(rest);
+    other.compact_step(3);
+    std::swap(other, rest);
+    other.compact_step(3);
+    rest.compact_step(3);
+    ASSERT_EQ(other, rest);
+}
+
+TEST(Compaction, mergeResetsCursorOfOther) {
+    unrolled_list<int, 4> lhs;
+    unrolled_list<int, 4> rhs;
+    for (int i = 0; i < 17; ++i) {
+        rhs.push_back(i);
+    }
+    for (int i = 0; i < 5; ++i) {
+        rhs.erase(rhs.nth(i * 2));
+    }
+    rhs.compact_step(2);
+    rhs.set_incremental_compaction(8);
+
+    // В пустой список ноды rhs переходят целиком, вместе с курсором rhs
+    lhs.merge(rhs);
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        lhs.erase(lhs.nth(i));
+    }
+    for (int i = 0; i < 6; ++i) {
+        rhs.push_back(i);
+    }
+
+    ASSERT_EQ(std::distance(lhs.begin(), lhs.end()), lhs.size());
+    ASSERT_TRUE(std::is_sorted(lhs.begin(), lhs.end()));
+    ASSERT_THAT(rhs, ::testing::ElementsAre(0, 1, 2, 3, 4, 5));
+}
+
+TEST(Compaction, pushCopiesOwnElement) {
+    unrolled_list<std::string, 4> list;
+    std::vector<std::string> expected;
+    Churn(list, expected, 9);
+    list.set_incremental_compaction(3);
+
+    for (size_t i = 0; i < 200; ++i) {
+        const size_t pos = (i * 13) % expected.size();
+        if (i % 2 == 0) {
+            list.push_back(list[pos]);
+            expected.push_back(expected[pos]);
+        } else {
+            std::string& front = list.emplace_front(list[pos]);
+            expected.insert(expected.begin(), expected[pos]);
+            ASSERT_EQ(front, expected.front());
+        }
+    }
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+}
+
+TEST(Compaction, rangeInsertRunsSteps) {
+    unrolled_list<std::string, 8> list;
+    std::vector<std::string> expected;
+    Churn(list, expected, 11);
+    unrolled_list<std::string, 8> plain(list);
+    for (int i = 0; i < 10; ++i) {
+        plain.erase(plain.nth(i * 3));
+        list.erase(list.nth(i * 3));
+    }
+    list.set_incremental_compaction(4);
+
+    for (int i = 0; i < 20; ++i) {
+        const size_t pos = (i * 17) % list.size();
+        auto it = list.insert(list.nth(pos), {"a", "b"});
+        ASSERT_EQ(*it, "a");
+        plain.insert(plain.nth(pos), {"a", "b"});
+    }
+
+    ASSERT_EQ(list, plain);
+    ASSERT_LT(list.fragmentation(), plain.fragmentation());
+}
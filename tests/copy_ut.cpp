@@ -0,0 +1,159 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "counting_allocator.hpp"
+#include "list_factories.hpp"
+
+/*
+    Тесты на копирующий конструктор и копирующее присваивание.
+    Копия строится нода в ноду, поэтому заполнение нод должно совпадать с исходным,
+    а присваивание должно переиспользовать уже выделенные ноды
+*/
+
+namespace {
+
+struct CopyTag : CountingAllocatorTag {
+    static constexpr bool PropagateOnCopy = true;
+};
+
+template<typename T>
+using CopyAllocator = CountingAllocator<T, CopyTag>;
+
+class ThrowingCopy {
+public:
+    static inline int Alive = 0;
+    static inline int CopiesLeft = 1000;
+
+    ThrowingCopy(int value)
+        : Value(value) {
+        ++Alive;
+    }
+
+    ThrowingCopy(const ThrowingCopy& other)
+        : Value(other.Value) {
+        if (CopiesLeft-- == 0) {
+            throw std::runtime_error("");
+        }
+        ++Alive;
+    }
+
+    ~ThrowingCopy() {
+        --Alive;
+    }
+
+    int Value;
+};
+
+template<typename List>
+std::vector<size_t> Layout(const List& list) {
+    std::vector<size_t> sizes;
+    for (auto segment : list.segments()) {
+        sizes.push_back(segment.size());
+    }
+    return sizes;
+}
+
+} // namespace
+
+TEST(Copy, keepsNodeLayout) {
+    using List = unrolled_list<std::string, 8, std::allocator<std::string>, unrolled_list_node_index>;
+    const auto source = Fragmented<List>(500);
+
+    const List copy(source);
+
+    ASSERT_EQ(copy, source);
+    ASSERT_EQ(copy.size(), source.size());
+    ASSERT_EQ(Layout(copy), Layout(source));
+    for (size_t i = 0; i < source.size(); i += 13) {
+        ASSERT_EQ(copy[i], source[i]);
+    }
+}
+
+TEST(Copy, trivialElements) {
+    unrolled_list<int, 16> source;
+    for (int i = 0; i < 1000; ++i) {
+        source.push_front(i);
+    }
+
+    unrolled_list<int, 16> copy(source);
+    ASSERT_EQ(copy, source);
+    ASSERT_EQ(Layout(copy), Layout(source));
+
+    copy.push_back(5);
+    ASSERT_EQ(source.size(), 1000);
+}
+
+TEST(Copy, assignmentReusesNodes) {
+    using List = unrolled_list<std::string, 8, CopyAllocator<std::string>>;
+    const auto source = Fragmented<List>(400);
+    auto target = Fragmented<List>(500);
+    const auto shorter = Fragmented<List>(30);
+
+    AllocatorCounters<CopyTag>::Allocations = 0;
+    target = source;
+    ASSERT_EQ(AllocatorCounters<CopyTag>::Allocations, 0);
+    ASSERT_EQ(target, source);
+    ASSERT_EQ(Layout(target), Layout(source));
+
+    target = shorter;
+    ASSERT_EQ(AllocatorCounters<CopyTag>::Allocations, 0);
+    ASSERT_EQ(target, shorter);
+
+    target = source;
+    ASSERT_EQ(target, source);
+
+    List empty;
+    target = empty;
+    ASSERT_TRUE(target.empty());
+    ASSERT_EQ(target.begin(), target.end());
+}
+
+TEST(Copy, propagatedAllocatorIsAdopted) {
+    using List = unrolled_list<int, 4, CopyAllocator<int>>;
+    List source(CopyAllocator<int>(1));
+    List target(CopyAllocator<int>(2));
+    for (int i = 0; i < 50; ++i) {
+        source.push_back(i);
+        target.push_back(-i);
+    }
+
+    target = source;
+    ASSERT_EQ(target.get_allocator().Id, 1);
+    ASSERT_EQ(target, source);
+}
+
+TEST(Copy, throwingCopyLeavesNothingBehind) {
+    using List = unrolled_list<ThrowingCopy, 4>;
+    ThrowingCopy::Alive = 0;
+    {
+        List source;
+        for (int i = 0; i < 40; ++i) {
+            source.push_back(ThrowingCopy(i));
+        }
+        ThrowingCopy::CopiesLeft = 1000;
+        List target(source);
+
+        for (int fail_at : {0, 3, 17, 39}) {
+            ThrowingCopy::CopiesLeft = fail_at;
+            ASSERT_THROW(List copy(source), std::runtime_error);
+            ASSERT_EQ(ThrowingCopy::Alive, 80);
+
+            ThrowingCopy::CopiesLeft = fail_at;
+            ASSERT_THROW(target = source, std::runtime_error);
+            ASSERT_TRUE(target.empty());
+            ASSERT_EQ(target.size(), 0);
+            ASSERT_EQ(ThrowingCopy::Alive, 40);
+
+            ThrowingCopy::CopiesLeft = 1000;
+            target = source;
+            ASSERT_EQ(target.size(), 40);
+        }
+    }
+    ASSERT_EQ(ThrowingCopy::Alive, 0);
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/*
+    Аллокатор для тестов, считающий обращения к нему.
+    Счётчики общие для всех rebind-ов с одним тегом; тег каждого теста
+    наследуется от CountingAllocatorTag и может переопределить флаги
+*/
+
+struct CountingAllocatorTag {
+    static constexpr bool PropagateOnCopy = false;
+    // Свои construct/destroy отключают быстрые пути для тривиальных типов
+    static constexpr bool CountConstructs = false;
+};
+
+template<typename Tag>
+struct AllocatorCounters {
+    static inline long Allocations = 0;
+    static inline long Deallocations = 0;
+    static inline long Live = 0;
+    static inline long Constructed = 0;
+    static inline long Destroyed = 0;
+
+    static void Reset() {
+        Allocations = Deallocations = Live = Constructed = Destroyed = 0;
+    }
+};
+
+template<typename T, typename Tag = CountingAllocatorTag>
+class CountingAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::bool_constant<Tag::PropagateOnCopy>;
+    using Counts = AllocatorCounters<Tag>;
+
+    // Аллокаторы с разными Id не равны
+    int Id = 0;
+
+    CountingAllocator(int id = 0)
+        : Id(id) {}
+
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U, Tag>& other)
+        : Id(other.Id) {}
+
+    T* allocate(size_t n) {
+        ++Counts::Allocations;
+        ++Counts::Live;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) {
+        ++Counts::Deallocations;
+        --Counts::Live;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template<typename U, typename... Args>
+    void construct(U* p, Args&&... args) requires Tag::CountConstructs {
+        ++Counts::Constructed;
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    template<typename U>
+    void destroy(U* p) requires Tag::CountConstructs {
+        ++Counts::Destroyed;
+        p->~U();
+    }
+
+    template<typename U>
+    bool operator==(const CountingAllocator<U, Tag>& other) const {
+        return Id == other.Id;
+    }
+};
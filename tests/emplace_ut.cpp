@@ -0,0 +1,111 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+    Тесты на emplace_back, emplace_front, emplace и rvalue-перегрузки push_* / insert.
+    Проверяется, что move-only типы поддерживаются, а копирования не происходит
+*/
+
+class CopyCounter {
+public:
+    static inline int Copies = 0;
+
+    CopyCounter(int value, std::string name)
+        : Value(value), Name(std::move(name)) {}
+
+    CopyCounter(const CopyCounter& other)
+        : Value(other.Value), Name(other.Name) {
+        ++Copies;
+    }
+
+    CopyCounter(CopyCounter&&) noexcept = default;
+    CopyCounter& operator=(CopyCounter&&) noexcept = default;
+
+    int Value;
+    std::string Name;
+};
+
+TEST(Emplace, moveOnlyType) {
+    unrolled_list<std::unique_ptr<int>, 4> list;
+
+    for (int i = 0; i < 20; ++i) {
+        list.push_back(std::make_unique<int>(i));
+    }
+    list.push_front(std::make_unique<int>(-1));
+    list.emplace_front(new int(-2));
+
+    for (int i = 0; i < 20; ++i) {
+        list.insert(list.nth(5 + i), std::make_unique<int>(100 + i));
+    }
+    list.emplace(list.nth(11), new int(1000));
+
+    std::vector<int> expected = {-2, -1, 0, 1, 2};
+    for (int i = 0; i < 20; ++i) {
+        expected.push_back(100 + i);
+        if (expected.size() == 11) {
+            expected.push_back(1000);
+        }
+    }
+    for (int i = 3; i < 20; ++i) {
+        expected.push_back(i);
+    }
+
+    std::vector<int> actual;
+    for (const auto& ptr : list) {
+        actual.push_back(*ptr);
+    }
+    ASSERT_THAT(actual, ::testing::ElementsAreArray(expected));
+}
+
+TEST(Emplace, noCopies) {
+    CopyCounter::Copies = 0;
+    unrolled_list<CopyCounter, 5> list;
+
+    for (int i = 0; i < 30; ++i) {
+        list.emplace_back(i, "back");
+        list.emplace_front(-i, "front");
+        list.emplace(list.nth(list.size() / 2), i, "middle");
+    }
+    list.push_back(CopyCounter(0, "rvalue"));
+    list.insert(list.begin(), CopyCounter(0, "rvalue"));
+
+    ASSERT_EQ(list.size(), 92);
+    ASSERT_EQ(CopyCounter::Copies, 0);
+}
+
+TEST(Emplace, returnsReference) {
+    unrolled_list<std::string, 3> list;
+
+    std::string& back = list.emplace_back(3, 'b');
+    ASSERT_EQ(back, "bbb");
+    ASSERT_EQ(&list.back(), &back);
+
+    std::string& front = list.emplace_front("front");
+    ASSERT_EQ(front, "front");
+    ASSERT_EQ(&list.front(), &front);
+
+    auto it = list.emplace(list.nth(1), 2, 'm');
+    ASSERT_EQ(*it, "mm");
+}
+
+TEST(Emplace, selfReferencingArguments) {
+    unrolled_list<std::string, 4> list;
+    for (int i = 0; i < 4; ++i) {
+        list.push_back(std::string(16, static_cast<char>('a' + i)));
+    }
+
+    list.push_front(list.back());
+    list.insert(list.nth(2), list.front());
+    list.push_back(list.front());
+
+    ASSERT_THAT(list, ::testing::ElementsAre(
+        std::string(16, 'd'), std::string(16, 'a'), std::string(16, 'd'),
+        std::string(16, 'b'), std::string(16, 'c'), std::string(16, 'd'),
+        std::string(16, 'd')));
+}
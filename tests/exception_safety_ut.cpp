@@ -187,3 +187,158 @@ TEST_F(ExceptionSafetyTest, failesAtPushBack) {
     ASSERT_EQ(unrolled_list.begin()->Name, std::string("first"));
     ASSERT_EQ((++unrolled_list.begin())->Name, std::string("second"));
 }
+
+class ThrowingCopy {
+public:
+    static inline int CopiesLeft = 0;
+
+    ThrowingCopy(int value)
+        : Value(value) {}
+
+    ThrowingCopy(const ThrowingCopy& other)
+        : Value(other.Value) {
+        if (CopiesLeft-- == 0) {
+            throw std::runtime_error("");
+        }
+    }
+
+    // Не noexcept, поэтому при переносе между нодами используется копирование
+    ThrowingCopy(ThrowingCopy&& other)
+        : ThrowingCopy(static_cast<const ThrowingCopy&>(other)) {}
+
+    int Value;
+};
+
+/*
+    В тесте нода заполнена целиком, и вставка требует её разделения.
+    Копирование элемента выбрасывает исключение на разных шагах разделения.
+
+    Тест проверяет, что после исключения содержимое контейнера не изменилось
+*/
+TEST_F(ExceptionSafetyTest, failesAtInsertSplit) {
+    for (size_t pos = 0; pos <= 8; ++pos) {
+        for (int fail_at = 0; fail_at < 10; ++fail_at) {
+            ThrowingCopy::CopiesLeft = 1000;
+            unrolled_list<ThrowingCopy, 8> list;
+            for (int i = 0; i < 8; ++i) {
+                list.push_back(ThrowingCopy(i));
+            }
+
+            ThrowingCopy::CopiesLeft = fail_at;
+            bool thrown = false;
+            try {
+                list.insert(list.nth(pos), ThrowingCopy(100));
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+
+            ThrowingCopy::CopiesLeft = 1000;
+            std::vector<int> actual;
+            for (const auto& item : list) {
+                actual.push_back(item.Value);
+            }
+
+            std::vector<int> expected = {0, 1, 2, 3, 4, 5, 6, 7};
+            if (!thrown) {
+                expected.insert(expected.begin() + pos, 100);
+            }
+            ASSERT_THAT(actual, ::testing::ElementsAreArray(expected)) << pos << " " << fail_at;
+        }
+    }
+}
+
+class FailingCopy {
+public:
+    static inline int CopiesLeft = 0;
+
+    FailingCopy(int value)
+        : Value(value) {}
+
+    // В отличие от ThrowingCopy, после первого исключения бросает и дальше,
+    // так что откат, который копирует элементы, тоже упадёт
+    FailingCopy(const FailingCopy& other)
+        : Value(other.Value) {
+        if (CopiesLeft-- <= 0) {
+            throw std::runtime_error("");
+        }
+    }
+
+    FailingCopy(FailingCopy&& other)
+        : FailingCopy(static_cast<const FailingCopy&>(other)) {}
+
+    int Value;
+};
+
+/*
+    В тесте в ноде есть свободное место, но перемещение элемента может бросить.
+    Тест проверяет, что вставка либо удаётся, либо не меняет контейнер
+*/
+TEST_F(ExceptionSafetyTest, failesAtInsertIntoNode) {
+    for (size_t pos = 0; pos <= 5; ++pos) {
+        for (int fail_at = 0; fail_at < 8; ++fail_at) {
+            FailingCopy::CopiesLeft = 1000;
+            unrolled_list<FailingCopy, 8> list;
+            for (int i = 0; i < 5; ++i) {
+                list.push_back(FailingCopy(i));
+            }
+
+            FailingCopy::CopiesLeft = fail_at;
+            bool thrown = false;
+            try {
+                list.insert(list.nth(pos), FailingCopy(100));
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+
+            FailingCopy::CopiesLeft = 1000;
+            std::vector<int> actual;
+            for (const auto& item : list) {
+                actual.push_back(item.Value);
+            }
+
+            std::vector<int> expected = {0, 1, 2, 3, 4};
+            if (!thrown) {
+                expected.insert(expected.begin() + pos, 100);
+            }
+            ASSERT_EQ(list.size(), expected.size());
+            ASSERT_THAT(actual, ::testing::ElementsAreArray(expected)) << pos << " " << fail_at;
+        }
+    }
+}
+
+/*
+    То же для полной ноды: элемент вставляется в нижнюю половину после разделения.
+    Тест проверяет, что содержимое после исключения не изменилось
+*/
+TEST_F(ExceptionSafetyTest, failesAtInsertSplitWithThrowingMove) {
+    for (size_t pos = 0; pos <= 8; ++pos) {
+        for (int fail_at = 0; fail_at < 16; ++fail_at) {
+            FailingCopy::CopiesLeft = 1000;
+            unrolled_list<FailingCopy, 8> list;
+            for (int i = 0; i < 8; ++i) {
+                list.push_back(FailingCopy(i));
+            }
+
+            FailingCopy::CopiesLeft = fail_at;
+            bool thrown = false;
+            try {
+                list.insert(list.nth(pos), FailingCopy(100));
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+
+            FailingCopy::CopiesLeft = 1000;
+            std::vector<int> actual;
+            for (const auto& item : list) {
+                actual.push_back(item.Value);
+            }
+
+            std::vector<int> expected = {0, 1, 2, 3, 4, 5, 6, 7};
+            if (!thrown) {
+                expected.insert(expected.begin() + pos, 100);
+            }
+            ASSERT_EQ(list.size(), expected.size());
+            ASSERT_THAT(actual, ::testing::ElementsAreArray(expected)) << pos << " " << fail_at;
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*
+    Заготовки списков для тестов: подряд идущие значения
+    и список с неполными нодами после вставок в случайные места
+*/
+
+template<typename T>
+T ValueFromInt(int value) {
+    if constexpr (std::is_constructible_v<T, int>) {
+        return T(value);
+    } else {
+        return T(std::to_string(value));
+    }
+}
+
+// Значения [from, to) через push_back, ноды заполнены целиком
+template<typename List>
+List Make(int from, int to) {
+    List list;
+    for (int i = from; i < to; ++i) {
+        list.push_back(ValueFromInt<typename List::value_type>(i));
+    }
+    return list;
+}
+
+// count случайных значений, вставленных в случайные позиции; expected
+// получает ту же последовательность
+template<typename List>
+List Fragmented(std::vector<typename List::value_type>& expected, int count, unsigned seed) {
+    using T = typename List::value_type;
+    List list;
+    std::mt19937 rng(seed);
+    for (int i = 0; i < count; ++i) {
+        const T value = ValueFromInt<T>(static_cast<int>(rng() % 1000));
+        const size_t pos = rng() % (expected.size() + 1);
+        list.insert(list.nth(pos), value);
+        expected.insert(expected.begin() + pos, value);
+    }
+    return list;
+}
+
+template<typename List>
+List Fragmented(int count, unsigned seed = 1) {
+    std::vector<typename List::value_type> expected;
+    return Fragmented<List>(expected, count, seed);
+}
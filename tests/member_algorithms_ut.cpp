@@ -0,0 +1,299 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "counting_allocator.hpp"
+#include "list_factories.hpp"
+
+/*
+    Тесты на sort, stable_sort, merge, unique и remove_if.
+    Результаты сравниваются с алгоритмами над std::vector, кроме того
+    проверяется, что после операции все ноды, кроме последней, заполнены
+*/
+
+namespace {
+
+template<typename List>
+void ExpectPacked(const List& list, size_t capacity) {
+    size_t seen = 0;
+    for (auto segment : list.segments()) {
+        seen += segment.size();
+        if (seen != list.size()) {
+            ASSERT_EQ(segment.size(), capacity);
+        }
+    }
+    ASSERT_EQ(seen, list.size());
+}
+
+// Перемещение может бросить, поэтому алгоритмы, перекладывающие элементы
+// между нодами, для такого типа недоступны
+struct ThrowingMove {
+    ThrowingMove(int value)
+        : Value(value) {}
+
+    ThrowingMove(ThrowingMove&& other)
+        : Value(other.Value) {}
+
+    ThrowingMove(const ThrowingMove&) = default;
+
+    bool operator<(const ThrowingMove& other) const {
+        return Value < other.Value;
+    }
+
+    int Value;
+};
+
+template<typename List>
+concept Sortable = requires(List& list) { list.sort(); };
+
+template<typename List>
+concept Filterable = requires(List& list) { list.remove_if([](const auto&) { return true; }); };
+
+template<typename List>
+concept Mergeable = requires(List& list) { list.merge(list); };
+
+template<typename List>
+concept Splicable = requires(List& list, typename List::const_iterator it) { list.splice(it, list, it, it); };
+
+template<typename List>
+concept Compactable = requires(List& list) { list.compact(); };
+
+static_assert(Sortable<unrolled_list<std::string, 8>> && Filterable<unrolled_list<std::string, 8>>);
+static_assert(Mergeable<unrolled_list<std::string, 8>> && Splicable<unrolled_list<std::string, 8>>);
+static_assert(Compactable<unrolled_list<std::string, 8>>);
+
+static_assert(!Sortable<unrolled_list<ThrowingMove, 8>> && !Filterable<unrolled_list<ThrowingMove, 8>>);
+static_assert(!Mergeable<unrolled_list<ThrowingMove, 8>> && !Splicable<unrolled_list<ThrowingMove, 8>>);
+static_assert(!Compactable<unrolled_list<ThrowingMove, 8>>);
+
+} // namespace
+
+TEST(MemberAlgorithms, sortMatchesVector) {
+    for (int count : {0, 1, 7, 8, 9, 100, 1000}) {
+        std::vector<int> expected;
+        auto list = Fragmented<unrolled_list<int, 8>>(expected, count, count);
+
+        list.sort();
+        std::sort(expected.begin(), expected.end());
+
+        ASSERT_THAT(list, ::testing::ElementsAreArray(expected)) << count;
+        ExpectPacked(list, 8);
+    }
+}
+
+TEST(MemberAlgorithms, sortWithComparatorAndIndex) {
+    std::vector<int> expected;
+    auto list = Fragmented<unrolled_list<int, 16, std::allocator<int>, unrolled_list_node_index>>(expected, 900, 5);
+
+    list.sort(std::greater<>());
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+    for (size_t i = 0; i < expected.size(); i += 37) {
+        ASSERT_EQ(list[i], expected[i]);
+        ASSERT_EQ(list.index_of(list.nth(i)), i);
+    }
+}
+
+TEST(MemberAlgorithms, stableSortKeepsEqualOrder) {
+    unrolled_list<std::pair<int, std::string>, 4> list;
+    std::vector<std::pair<int, std::string>> expected;
+    std::mt19937 rng(11);
+    for (int i = 0; i < 300; ++i) {
+        std::pair<int, std::string> item(static_cast<int>(rng() % 10), std::to_string(i));
+        list.push_front(item);
+        expected.insert(expected.begin(), item);
+    }
+
+    const auto by_key = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+    list.stable_sort(by_key);
+    std::stable_sort(expected.begin(), expected.end(), by_key);
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+}
+
+TEST(MemberAlgorithms, sortReusesNodes) {
+    using List = unrolled_list<int, 8, CountingAllocator<int>>;
+    List list;
+    for (int i = 0; i < 4000; ++i) {
+        list.push_back((i * 7919) % 4000);
+    }
+
+    AllocatorCounters<CountingAllocatorTag>::Allocations = 0;
+    list.sort();
+
+    // Сверх освобождаемых по ходу слияния нужно не больше двух нод
+    ASSERT_LE(AllocatorCounters<CountingAllocatorTag>::Allocations, 2);
+    ASSERT_TRUE(std::is_sorted(list.begin(), list.end()));
+}
+
+TEST(MemberAlgorithms, throwingComparatorKeepsElements) {
+    const auto make = [](std::vector<std::string>& expected) {
+        unrolled_list<std::string, 8> list;
+        for (int i = 0; i < 300; ++i) {
+            list.push_back(std::to_string((i * 37) % 300));
+            expected.push_back(list.back());
+        }
+        return list;
+    };
+
+    int total = 0;
+    {
+        std::vector<std::string> expected;
+        auto list = make(expected);
+        list.sort([&](const std::string& lhs, const std::string& rhs) { return ++total, lhs < rhs; });
+    }
+
+    // Последние сравнения приходятся на слияние нод: все значения сохраняются.
+    // Раньше исключение может прервать std::sort внутри ноды, тогда сохраняется только размер
+    for (int fail_at : {0, 10, total / 2, total - 5}) {
+        std::vector<std::string> expected;
+        auto list = make(expected);
+
+        int calls = 0;
+        const auto comp = [&](const std::string& lhs, const std::string& rhs) {
+            if (calls++ == fail_at) {
+                throw std::runtime_error("");
+            }
+            return lhs < rhs;
+        };
+        ASSERT_THROW(list.sort(comp), std::runtime_error);
+
+        ASSERT_EQ(list.size(), expected.size());
+        ASSERT_EQ(static_cast<size_t>(std::distance(list.begin(), list.end())), expected.size());
+        if (fail_at == total - 5) {
+            ASSERT_THAT(list, ::testing::UnorderedElementsAreArray(expected));
+        }
+    }
+}
+
+TEST(MemberAlgorithms, mergeSortedLists) {
+    unrolled_list<int, 8> lhs;
+    unrolled_list<int, 8> rhs;
+    std::vector<int> expected;
+    for (int i = 0; i < 200; ++i) {
+        lhs.push_back(i * 3);
+        expected.push_back(i * 3);
+    }
+    for (int i = 0; i < 150; ++i) {
+        rhs.push_back(i * 2);
+        expected.push_back(i * 2);
+    }
+
+    lhs.merge(rhs);
+    std::sort(expected.begin(), expected.end());
+
+    ASSERT_THAT(lhs, ::testing::ElementsAreArray(expected));
+    ASSERT_TRUE(rhs.empty());
+    ASSERT_EQ(rhs.size(), 0);
+
+    unrolled_list<int, 8> tail = {1000, 1001};
+    lhs.merge(std::move(tail));
+    expected.push_back(1000);
+    expected.push_back(1001);
+    ASSERT_THAT(lhs, ::testing::ElementsAreArray(expected));
+
+    unrolled_list<int, 8> empty;
+    empty.merge(lhs);
+    ASSERT_THAT(empty, ::testing::ElementsAreArray(expected));
+    ASSERT_TRUE(lhs.empty());
+}
+
+TEST(MemberAlgorithms, mergeIsStable) {
+    using Item = std::pair<int, int>;
+    unrolled_list<Item, 4> lhs = {{1, 0}, {2, 0}, {2, 1}, {5, 0}};
+    unrolled_list<Item, 4> rhs = {{0, 2}, {2, 2}, {5, 2}, {6, 2}};
+
+    lhs.merge(rhs, [](const Item& a, const Item& b) { return a.first < b.first; });
+
+    ASSERT_THAT(lhs, ::testing::ElementsAre(Item{0, 2}, Item{1, 0}, Item{2, 0}, Item{2, 1}, Item{2, 2},
+                                            Item{5, 0}, Item{5, 2}, Item{6, 2}));
+}
+
+TEST(MemberAlgorithms, removeIfCompactsNodes) {
+    std::vector<int> expected;
+    auto list = Fragmented<unrolled_list<int, 8>>(expected, 1000, 21);
+
+    const auto odd = [](int value) { return value % 2 != 0; };
+    const size_t removed = list.remove_if(odd);
+    const auto kept = std::remove_if(expected.begin(), expected.end(), odd);
+    ASSERT_EQ(removed, static_cast<size_t>(expected.end() - kept));
+    expected.erase(kept, expected.end());
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+    ExpectPacked(list, 8);
+
+    ASSERT_EQ(list.remove_if([](int) { return true; }), expected.size());
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.begin(), list.end());
+}
+
+TEST(MemberAlgorithms, removeValueFromList) {
+    unrolled_list<std::string, 4> list = {"a", "b", "a", "c", "a"};
+    ASSERT_EQ(list.remove(list.front()), 3);
+    ASSERT_THAT(list, ::testing::ElementsAre("b", "c"));
+}
+
+TEST(MemberAlgorithms, uniqueMatchesVector) {
+    unrolled_list<std::string, 8, std::allocator<std::string>, unrolled_list_node_index> list;
+    std::vector<std::string> expected;
+    std::mt19937 rng(2);
+    for (int i = 0; i < 2000; ++i) {
+        const std::string value(1, static_cast<char>('a' + rng() % 3));
+        list.push_back(value);
+        expected.push_back(value);
+    }
+
+    const size_t removed = list.unique();
+    const auto kept = std::unique(expected.begin(), expected.end());
+    ASSERT_EQ(removed, static_cast<size_t>(expected.end() - kept));
+    expected.erase(kept, expected.end());
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+    ASSERT_EQ(list.nth(expected.size() / 2), std::next(list.begin(), expected.size() / 2));
+}
+
+TEST(MemberAlgorithms, uniqueComparesWithFirstOfRun) {
+    unrolled_list<int, 4> list = {1, 2, 3, 10, 11, 12, 20, 21};
+    list.unique([](int first, int item) { return item - first < 2; });
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 3, 10, 12, 20));
+}
+
+TEST(MemberAlgorithms, throwingPredicateKeepsRest) {
+    unrolled_list<int, 4> list;
+    for (int i = 0; i < 20; ++i) {
+        list.push_back(i);
+    }
+
+    int calls = 0;
+    ASSERT_THROW(list.remove_if([&](int value) {
+        if (calls++ == 10) {
+            throw std::runtime_error("");
+        }
+        return value % 2 == 0;
+    }), std::runtime_error);
+
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 3, 5, 7, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19));
+    ASSERT_EQ(list.size(), 15);
+}
+
+TEST(MemberAlgorithms, throwingMoveStillShrinks) {
+    unrolled_list<ThrowingMove, 4> list;
+    for (int i = 0; i < 20; ++i) {
+        list.push_back(ThrowingMove(i));
+    }
+    list.erase(list.nth(3), list.nth(15));
+    list.shrink_to_fit();
+
+    ASSERT_EQ(list.size(), 8);
+    ASSERT_EQ(list.cached_nodes(), 0);
+    ASSERT_EQ(list.back().Value, 19);
+}
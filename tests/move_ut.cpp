@@ -0,0 +1,171 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "list_factories.hpp"
+
+/*
+    Тесты на перемещающие конструктор и присваивание.
+    При равных аллокаторах ноды должны переходить к новому владельцу без копирования
+    элементов, при неравных элементы перемещаются в ноды своего аллокатора
+*/
+
+namespace {
+
+class CopyCounter {
+public:
+    static inline int Copies = 0;
+
+    CopyCounter(int value)
+        : Value(value) {}
+
+    CopyCounter(const CopyCounter& other)
+        : Value(other.Value) {
+        ++Copies;
+    }
+
+    CopyCounter(CopyCounter&&) noexcept = default;
+    CopyCounter& operator=(const CopyCounter&) = default;
+    CopyCounter& operator=(CopyCounter&&) noexcept = default;
+
+    bool operator==(const CopyCounter&) const = default;
+
+    int Value;
+};
+
+template<typename T>
+class TaggedAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::false_type;
+
+    int Id = 0;
+
+    TaggedAllocator(int id = 0)
+        : Id(id) {}
+
+    template<typename U>
+    TaggedAllocator(const TaggedAllocator<U>& other)
+        : Id(other.Id) {}
+
+    T* allocate(size_t n) {
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template<typename U>
+    bool operator==(const TaggedAllocator<U>& other) const {
+        return Id == other.Id;
+    }
+};
+
+} // namespace
+
+static_assert(std::is_nothrow_move_constructible_v<unrolled_list<std::string>>);
+static_assert(std::is_nothrow_move_assignable_v<unrolled_list<std::string>>);
+static_assert(std::is_nothrow_move_assignable_v<unrolled_list<int, 8, TaggedAllocator<int>>>);
+static_assert(!std::is_nothrow_move_assignable_v<unrolled_list_pmr<int>>);
+
+TEST(Move, constructionStealsNodes) {
+    auto source = Make<unrolled_list<int, 8, std::allocator<int>, unrolled_list_node_index>>(0, 100);
+    const int* first = &source.front();
+
+    auto target = std::move(source);
+
+    ASSERT_EQ(&target.front(), first);
+    ASSERT_EQ(target.size(), 100);
+    ASSERT_EQ(target[57], 57);
+    ASSERT_TRUE(source.empty());
+    ASSERT_EQ(source.size(), 0);
+
+    source.push_back(1);
+    source.push_front(0);
+    ASSERT_THAT(source, ::testing::ElementsAre(0, 1));
+    ASSERT_EQ(source[1], 1);
+}
+
+TEST(Move, assignmentStealsNodes) {
+    auto source = Make<unrolled_list<int, 8>>(0, 100);
+    auto target = Make<unrolled_list<int, 8>>(0, 10);
+    const int* first = &source.front();
+
+    target = std::move(source);
+    ASSERT_EQ(&target.front(), first);
+    ASSERT_EQ(target.size(), 100);
+    ASSERT_TRUE(source.empty());
+
+    target = std::move(target);
+    ASSERT_EQ(target.size(), 100);
+}
+
+TEST(Move, swapAndReturnDoNotCopy) {
+    using List = unrolled_list<CopyCounter, 4>;
+    List lhs = Make<List>(0, 50);
+    List rhs = Make<List>(0, 20);
+    CopyCounter::Copies = 0;
+
+    std::swap(lhs, rhs);
+    ASSERT_EQ(lhs.size(), 20);
+    ASSERT_EQ(rhs.size(), 50);
+
+    std::vector<List> lists;
+    lists.push_back(std::move(lhs));
+    lists.push_back(std::move(rhs));
+    lists.reserve(16);
+    ASSERT_EQ(lists[1].size(), 50);
+    ASSERT_EQ(CopyCounter::Copies, 0);
+}
+
+TEST(Move, propagatedAllocatorIsAdopted) {
+    using List = unrolled_list<int, 4, TaggedAllocator<int>>;
+    List source(TaggedAllocator<int>(1));
+    List target(TaggedAllocator<int>(2));
+    for (int i = 0; i < 30; ++i) {
+        source.push_back(i);
+        target.push_back(-i);
+    }
+    const int* first = &source.front();
+
+    target = std::move(source);
+    ASSERT_EQ(target.get_allocator().Id, 1);
+    ASSERT_EQ(&target.front(), first);
+    ASSERT_EQ(target.size(), 30);
+}
+
+TEST(Move, unequalResourcesMoveElements) {
+    std::pmr::unsynchronized_pool_resource first_resource;
+    std::pmr::unsynchronized_pool_resource second_resource;
+    unrolled_list_pmr<std::pmr::string, 4> source(&first_resource);
+    for (int i = 0; i < 20; ++i) {
+        source.push_back(std::pmr::string(40, static_cast<char>('a' + i)));
+    }
+
+    unrolled_list_pmr<std::pmr::string, 4> target(&second_resource);
+    target.push_back("old");
+    target = std::move(source);
+    ASSERT_EQ(target.size(), 20);
+    ASSERT_EQ(target.back(), std::pmr::string(40, 't'));
+    ASSERT_TRUE(source.empty());
+    for (const auto& item : target) {
+        ASSERT_EQ(item.get_allocator().resource(), &second_resource);
+    }
+
+    unrolled_list_pmr<std::pmr::string, 4> moved(std::move(target), &first_resource);
+    ASSERT_EQ(moved.size(), 20);
+    ASSERT_EQ(moved.front().get_allocator().resource(), &first_resource);
+
+    unrolled_list_pmr<std::pmr::string, 4> same(std::move(moved), &first_resource);
+    ASSERT_EQ(same.size(), 20);
+    ASSERT_TRUE(moved.empty());
+}
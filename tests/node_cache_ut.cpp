@@ -0,0 +1,105 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <deque>
+
+#include "counting_allocator.hpp"
+
+/*
+    Тесты на кэш освобождённых нод.
+    Аллокатор считает обращения к себе, чтобы видеть, когда ноды берутся из кэша
+*/
+
+namespace {
+
+using Calls = AllocatorCounters<CountingAllocatorTag>;
+using CountedList = unrolled_list<int, 8, CountingAllocator<int>>;
+
+void ResetCalls() {
+    Calls::Allocations = 0;
+    Calls::Deallocations = 0;
+}
+
+} // namespace
+
+TEST(NodeCache, queueChurnReusesNodes) {
+    ResetCalls();
+    {
+        CountedList list;
+        std::deque<int> expected;
+        long warm = 0;
+        for (int i = 0; i < 10000; ++i) {
+            list.push_back(i);
+            expected.push_back(i);
+            if (i >= 100) {
+                list.pop_front();
+                expected.pop_front();
+            }
+            // После первого круга очередь живёт на уже выделенных нодах
+            if (i == 200) {
+                warm = Calls::Allocations;
+            }
+        }
+
+        ASSERT_EQ(Calls::Allocations, warm);
+        ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+    }
+    ASSERT_EQ(Calls::Allocations, Calls::Deallocations);
+}
+
+TEST(NodeCache, disabledCacheCallsAllocator) {
+    ResetCalls();
+    {
+        CountedList list;
+        list.set_node_cache_limit(0);
+        for (int i = 0; i < 80; ++i) {
+            list.push_back(i);
+        }
+        for (int i = 0; i < 80; ++i) {
+            list.pop_front();
+        }
+
+        ASSERT_EQ(list.cached_nodes(), 0);
+        ASSERT_EQ(Calls::Deallocations, 10);
+    }
+    ASSERT_EQ(Calls::Allocations, Calls::Deallocations);
+}
+
+TEST(NodeCache, limitBoundsCachedNodes) {
+    ResetCalls();
+    CountedList list;
+    list.set_node_cache_limit(3);
+    for (int i = 0; i < 80; ++i) {
+        list.push_back(i);
+    }
+    list.clear();
+
+    ASSERT_EQ(list.cached_nodes(), 3);
+    ASSERT_EQ(Calls::Deallocations, 7);
+
+    list.set_node_cache_limit(1);
+    ASSERT_EQ(list.cached_nodes(), 1);
+    ASSERT_EQ(list.node_cache_limit(), 1);
+}
+
+TEST(NodeCache, reserveAndShrink) {
+    ResetCalls();
+    CountedList list;
+    list.reserve_nodes(10);
+
+    ASSERT_EQ(list.cached_nodes(), 10);
+    ASSERT_EQ(Calls::Allocations, 10);
+
+    for (int i = 0; i < 80; ++i) {
+        list.push_back(i);
+    }
+    ASSERT_EQ(Calls::Allocations, 10);
+    ASSERT_EQ(list.cached_nodes(), 0);
+
+    list.clear();
+    list.shrink_to_fit();
+    ASSERT_EQ(list.cached_nodes(), 0);
+    ASSERT_EQ(Calls::Allocations, Calls::Deallocations);
+}
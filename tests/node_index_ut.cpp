@@ -0,0 +1,104 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <random>
+#include <vector>
+
+/*
+    Тесты на индексированный режим (unrolled_list_node_index).
+    После каждой операции вставки/удаления проверяется, что nth и index_of
+    согласованы с эталонным std::vector
+*/
+
+template<typename List>
+void ExpectIndexConsistent(List& list, const std::vector<int>& expected) {
+    ASSERT_EQ(list.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        auto it = list.nth(i);
+        ASSERT_EQ(*it, expected[i]);
+        ASSERT_EQ(list.index_of(it), i);
+    }
+    ASSERT_EQ(list.index_of(list.end()), expected.size());
+}
+
+TEST(NodeIndex, pushAndPop) {
+    unrolled_list<int, 4, std::allocator<int>, unrolled_list_node_index> list;
+    std::vector<int> expected;
+
+    for (int i = 0; i < 200; ++i) {
+        if (i % 2 == 0) {
+            list.push_back(i);
+            expected.push_back(i);
+        } else {
+            list.push_front(i);
+            expected.insert(expected.begin(), i);
+        }
+    }
+    ExpectIndexConsistent(list, expected);
+
+    for (int i = 0; i < 50; ++i) {
+        list.pop_front();
+        expected.erase(expected.begin());
+        list.pop_back();
+        expected.pop_back();
+    }
+    ExpectIndexConsistent(list, expected);
+}
+
+TEST(NodeIndex, randomInsertErase) {
+    unrolled_list<int, 6, std::allocator<int>, unrolled_list_node_index> list;
+    std::vector<int> expected;
+    std::mt19937 rng(7);
+
+    for (int step = 0; step < 3000; ++step) {
+        const bool do_insert = expected.size() < 50 || rng() % 3 != 0;
+        if (do_insert) {
+            const size_t pos = rng() % (expected.size() + 1);
+            list.insert(list.nth(pos), step);
+            expected.insert(expected.begin() + pos, step);
+        } else {
+            const size_t pos = rng() % expected.size();
+            auto it = list.erase(list.nth(pos));
+            expected.erase(expected.begin() + pos);
+            ASSERT_EQ(list.index_of(it), pos);
+        }
+
+        if (step % 250 == 0) {
+            ExpectIndexConsistent(list, expected);
+        }
+    }
+    ExpectIndexConsistent(list, expected);
+}
+
+TEST(NodeIndex, distanceMatchesPlainList) {
+    unrolled_list<int, 5, std::allocator<int>, unrolled_list_node_index> indexed;
+    unrolled_list<int, 5> plain;
+    for (int i = 0; i < 97; ++i) {
+        indexed.push_back(i);
+        plain.push_back(i);
+    }
+
+    ASSERT_EQ(indexed.distance(indexed.begin(), indexed.end()), 97);
+    ASSERT_EQ(plain.distance(plain.begin(), plain.end()), 97);
+    ASSERT_EQ(indexed.distance(indexed.nth(10), indexed.nth(60)), 50);
+    ASSERT_EQ(plain.distance(plain.nth(60), plain.nth(10)), -50);
+    ASSERT_EQ(plain.index_of(plain.nth(33)), 33);
+}
+
+TEST(NodeIndex, bulkInsert) {
+    unrolled_list<int, 8, std::allocator<int>, unrolled_list_node_index> list;
+    std::vector<int> expected;
+
+    for (int round = 0; round < 20; ++round) {
+        std::vector<int> range(round * 5 + 1, round);
+        const size_t pos = (round * 37) % (expected.size() + 1);
+        list.insert(list.nth(pos), range.begin(), range.end());
+        expected.insert(expected.begin() + pos, range.begin(), range.end());
+        list.append_range(range);
+        expected.insert(expected.end(), range.begin(), range.end());
+    }
+
+    ExpectIndexConsistent(list, expected);
+}
@@ -0,0 +1,95 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <deque>
+#include <random>
+#include <string>
+
+/*
+    Тесты на раскладку элементов внутри ноды со смещением начала.
+    Операции с обоих концов и вставки/удаления в середине сравниваются с std::deque
+*/
+
+TEST(NodeLayout, fifoQueue) {
+    std::deque<int> std_deque;
+    unrolled_list<int, 256> unrolled_list;
+
+    for (int i = 0; i < 100000; ++i) {
+        std_deque.push_back(i);
+        unrolled_list.push_back(i);
+        if (i % 3 != 0) {
+            ASSERT_EQ(unrolled_list.front(), std_deque.front());
+            std_deque.pop_front();
+            unrolled_list.pop_front();
+        }
+    }
+
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_deque));
+}
+
+TEST(NodeLayout, lifoAtFront) {
+    std::deque<int> std_deque;
+    unrolled_list<int, 16> unrolled_list;
+
+    for (int i = 0; i < 1000; ++i) {
+        std_deque.push_front(i);
+        unrolled_list.push_front(i);
+        if (i % 4 == 0) {
+            std_deque.pop_back();
+            unrolled_list.pop_back();
+        }
+    }
+
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_deque));
+}
+
+TEST(NodeLayout, randomOperations) {
+    std::deque<std::string> std_deque;
+    unrolled_list<std::string, 8> unrolled_list;
+    std::mt19937 rng(12345);
+
+    for (int step = 0; step < 20000; ++step) {
+        const std::string value = std::to_string(step);
+        switch (rng() % 6) {
+            case 0:
+                std_deque.push_front(value);
+                unrolled_list.push_front(value);
+                break;
+            case 1:
+                std_deque.push_back(value);
+                unrolled_list.push_back(value);
+                break;
+            case 2:
+                if (!std_deque.empty()) {
+                    std_deque.pop_front();
+                    unrolled_list.pop_front();
+                }
+                break;
+            case 3:
+                if (!std_deque.empty()) {
+                    std_deque.pop_back();
+                    unrolled_list.pop_back();
+                }
+                break;
+            case 4: {
+                const size_t pos = rng() % (std_deque.size() + 1);
+                std_deque.insert(std_deque.begin() + pos, value);
+                unrolled_list.insert(unrolled_list.nth(pos), value);
+                break;
+            }
+            default:
+                if (!std_deque.empty()) {
+                    const size_t pos = rng() % std_deque.size();
+                    std_deque.erase(std_deque.begin() + pos);
+                    unrolled_list.erase(unrolled_list.nth(pos));
+                }
+                break;
+        }
+
+        ASSERT_EQ(unrolled_list.size(), std_deque.size());
+    }
+
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_deque));
+}
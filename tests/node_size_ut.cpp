@@ -0,0 +1,72 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <list>
+#include <string>
+
+/*
+    Тесты на подбор размера ноды по бюджету в байтах.
+    Раскладка проверяется на этапе компиляции, поведение - сравнением с std::list
+*/
+
+namespace {
+
+struct alignas(64) CacheLine {
+    int value;
+};
+
+} // namespace
+
+static_assert(unrolled_list_node_fits<unrolled_list<int>, unrolled_list_default_node_bytes>);
+static_assert(unrolled_list_node_fits<unrolled_list<std::string>, unrolled_list_default_node_bytes>);
+static_assert(unrolled_list_node_fits<unrolled_list_bytes<int, 4096>, 4096>);
+static_assert(unrolled_list_node_fits<unrolled_list_bytes<double, 256>, 256>);
+static_assert(unrolled_list_node_fits<unrolled_list_bytes<CacheLine, 512>, 512>);
+
+static_assert(unrolled_list_bytes<int, 4096>::node_layout().node_bytes == 4096);
+static_assert(unrolled_list_bytes<CacheLine, 512>::node_layout().cache_lines == 8);
+static_assert(unrolled_list_bytes<int, 64>::node_layout().node_capacity == 8);
+static_assert(unrolled_list_bytes<CacheLine, 64>::node_layout().node_capacity == 2);
+
+TEST(NodeSize, defaultFillsSeveralCacheLines) {
+    constexpr auto layout = unrolled_list<int>::node_layout();
+
+    ASSERT_EQ(layout.element_size, sizeof(int));
+    ASSERT_GT(layout.node_capacity, 10);
+    ASSERT_LE(layout.node_bytes, unrolled_list_default_node_bytes);
+    ASSERT_GT(layout.node_bytes, unrolled_list_default_node_bytes - sizeof(int));
+}
+
+TEST(NodeSize, pageSizedNodes) {
+    std::list<int> std_list;
+    unrolled_list_bytes<int, 4096> unrolled_list;
+
+    for (int i = 0; i < 10000; ++i) {
+        std_list.push_back(i);
+        unrolled_list.push_back(i);
+    }
+    for (int i = 0; i < 100; ++i) {
+        std_list.insert(std::next(std_list.begin(), 5000), -i);
+        unrolled_list.insert(unrolled_list.nth(5000), -i);
+    }
+
+    ASSERT_THAT(unrolled_list, ::testing::ElementsAreArray(std_list));
+}
+
+TEST(NodeSize, oversizedElement) {
+    struct Big {
+        char data[1024];
+    };
+    using list_type = unrolled_list_bytes<Big, 256>;
+
+    ASSERT_EQ(list_type::node_layout().node_capacity, 2);
+
+    list_type unrolled_list;
+    for (int i = 0; i < 10; ++i) {
+        unrolled_list.push_back(Big{{static_cast<char>(i)}});
+    }
+    ASSERT_EQ(unrolled_list.size(), 10);
+    ASSERT_EQ(unrolled_list.back().data[0], 9);
+}
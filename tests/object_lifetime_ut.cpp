@@ -0,0 +1,106 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <string>
+
+/*
+    Тесты на время жизни объектов внутри нод.
+    Нода хранит сырую память, поэтому живых объектов T должно быть ровно size(),
+    и никакие объекты не должны создаваться "про запас" при аллокации ноды
+*/
+
+class LiveCounter {
+public:
+    static inline int Alive = 0;
+    static inline int DefaultConstructed = 0;
+
+    LiveCounter() {
+        ++Alive;
+        ++DefaultConstructed;
+    }
+
+    LiveCounter(int value)
+        : Value(value) {
+        ++Alive;
+    }
+
+    LiveCounter(const LiveCounter& other)
+        : Value(other.Value) {
+        ++Alive;
+    }
+
+    LiveCounter(LiveCounter&& other) noexcept
+        : Value(other.Value) {
+        ++Alive;
+    }
+
+    LiveCounter& operator=(const LiveCounter&) = default;
+    LiveCounter& operator=(LiveCounter&&) noexcept = default;
+
+    ~LiveCounter() {
+        --Alive;
+    }
+
+    int Value = 0;
+};
+
+class ObjectLifetimeTest : public testing::Test {
+public:
+    void SetUp() override {
+        LiveCounter::Alive = 0;
+        LiveCounter::DefaultConstructed = 0;
+    }
+};
+
+TEST_F(ObjectLifetimeTest, aliveMatchesSize) {
+    {
+        unrolled_list<LiveCounter, 8> list;
+        for (int i = 0; i < 100; ++i) {
+            if (i % 2 == 0) {
+                list.push_back(LiveCounter(i));
+            } else {
+                list.push_front(LiveCounter(i));
+            }
+            ASSERT_EQ(LiveCounter::Alive, static_cast<int>(list.size()));
+        }
+
+        for (int i = 0; i < 50; ++i) {
+            list.insert(list.nth(list.size() / 2), LiveCounter(i));
+            ASSERT_EQ(LiveCounter::Alive, static_cast<int>(list.size()));
+        }
+
+        for (int i = 0; i < 120; ++i) {
+            list.erase(list.nth((i * 7) % list.size()));
+            ASSERT_EQ(LiveCounter::Alive, static_cast<int>(list.size()));
+        }
+
+        list.pop_front();
+        list.pop_back();
+        ASSERT_EQ(LiveCounter::Alive, static_cast<int>(list.size()));
+    }
+
+    ASSERT_EQ(LiveCounter::Alive, 0);
+    ASSERT_EQ(LiveCounter::DefaultConstructed, 0);
+}
+
+TEST_F(ObjectLifetimeTest, stringsSurviveShifts) {
+    unrolled_list<std::string, 4> list;
+    std::vector<std::string> expected;
+
+    for (int i = 0; i < 64; ++i) {
+        std::string value(32, static_cast<char>('a' + i % 26));
+        const size_t pos = (i * 5) % (expected.size() + 1);
+        list.insert(list.nth(pos), value);
+        expected.insert(expected.begin() + pos, value);
+    }
+
+    while (expected.size() > 10) {
+        const size_t pos = expected.size() / 3;
+        list.erase(list.nth(pos));
+        expected.erase(expected.begin() + pos);
+    }
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+}
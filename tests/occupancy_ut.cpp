@@ -0,0 +1,100 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+/*
+    Тесты на отчёт о заполненности нод и карту раскладки (occupancy / dump_layout).
+    Проверяются счётчики байт, паддинг заголовка ноды и формат карты
+*/
+
+static_assert(unrolled_list<char, 3>::node_layout().padding_bytes > 0);
+
+TEST(Occupancy, layoutAddsUp) {
+    constexpr auto chars = unrolled_list<char, 3>::node_layout();
+    ASSERT_EQ(chars.payload_bytes + chars.header_bytes + chars.padding_bytes, chars.node_bytes);
+    ASSERT_EQ(chars.header_bytes, 2 * sizeof(size_t) + 2 * sizeof(void*));
+
+    constexpr auto strings = unrolled_list<std::string, 5>::node_layout();
+    ASSERT_EQ(strings.payload_bytes + strings.header_bytes + strings.padding_bytes, strings.node_bytes);
+}
+
+TEST(Occupancy, emptyList) {
+    unrolled_list<int, 8> list;
+    const auto stats = list.occupancy();
+    ASSERT_EQ(stats.nodes, 0);
+    ASSERT_EQ(stats.elements, 0);
+    ASSERT_EQ(stats.min_fill, 0);
+    ASSERT_EQ(stats.max_fill, 0);
+    ASSERT_EQ(stats.avg_fill, 0.0);
+    ASSERT_EQ(stats.bytes_allocated, 0);
+    ASSERT_EQ(stats.bytes_wasted, 0);
+
+    std::ostringstream out;
+    list.dump_layout(out);
+    const std::string dump = out.str();
+    ASSERT_EQ(std::count(dump.begin(), dump.end(), '\n'), 2);
+}
+
+TEST(Occupancy, walksNodes) {
+    using list_type = unrolled_list<int, 8>;
+    list_type list;
+    for (int i = 0; i < 1000; ++i) {
+        list.insert(std::next(list.begin(), static_cast<std::ptrdiff_t>((i * 7) % (list.size() + 1))), i);
+    }
+
+    const auto stats = list.occupancy();
+    ASSERT_EQ(stats.nodes, list.node_count());
+    ASSERT_EQ(stats.elements, 1000);
+    ASSERT_LE(stats.min_fill, stats.avg_fill);
+    ASSERT_LE(stats.avg_fill, stats.max_fill);
+    ASSERT_LE(stats.max_fill, 8);
+    ASSERT_DOUBLE_EQ(stats.avg_fill, 1000.0 / stats.nodes);
+
+    const size_t node_bytes = list_type::node_layout().node_bytes;
+    ASSERT_EQ(stats.bytes_allocated, (stats.nodes + stats.cached_nodes) * node_bytes);
+    ASSERT_EQ(stats.bytes_live, 1000 * sizeof(int));
+    ASSERT_EQ(stats.bytes_wasted, stats.bytes_allocated - stats.bytes_live);
+    ASSERT_DOUBLE_EQ(stats.wasted_bytes_per_node, node_bytes - 1000.0 * sizeof(int) / stats.nodes);
+    ASSERT_GE(stats.wasted_bytes_per_node, list_type::node_layout().header_bytes);
+}
+
+TEST(Occupancy, compactFillsNodes) {
+    unrolled_list<int, 8> list;
+    for (int i = 0; i < 100; ++i) {
+        list.insert(list.begin(), i);
+    }
+    list.compact();
+
+    const auto stats = list.occupancy();
+    ASSERT_EQ(stats.nodes, 13);
+    ASSERT_EQ(stats.max_fill, 8);
+    ASSERT_EQ(stats.min_fill, 4);
+}
+
+TEST(Occupancy, dumpLayoutMap) {
+    unrolled_list<int, 10> list;
+    for (int i = 0; i < 23; ++i) {
+        list.push_back(i);
+    }
+    list.compact();
+
+    std::ostringstream out;
+    list.dump_layout(out, 2);
+    std::istringstream lines(out.str());
+    std::string line;
+    std::getline(lines, line);
+    ASSERT_NE(line.find("nodes 3"), std::string::npos);
+    ASSERT_NE(line.find("elements 23"), std::string::npos);
+    std::getline(lines, line);
+    ASSERT_NE(line.find("bytes allocated"), std::string::npos);
+    std::getline(lines, line);
+    ASSERT_EQ(line, "##");
+    std::getline(lines, line);
+    ASSERT_EQ(line, "3");
+    ASSERT_FALSE(std::getline(lines, line));
+}
@@ -0,0 +1,157 @@
+#include <unrolled_list.hpp>
+#include <unrolled_list_parallel.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <execution>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+    Тесты на алгоритмы с политиками исполнения.
+    Списки достаточно большие, чтобы работа разделилась между потоками,
+    результаты сравниваются с последовательными алгоритмами над std::vector
+*/
+
+namespace {
+
+constexpr size_t kSize = 200000;
+
+template<typename List>
+List RandomList(std::vector<int>& expected, unsigned seed) {
+    std::mt19937 rng(seed);
+    List list;
+    for (size_t i = 0; i < kSize; ++i) {
+        const int value = static_cast<int>(rng() % 100000);
+        list.push_back(value);
+        expected.push_back(value);
+    }
+    // Неполные ноды в середине
+    for (size_t i = 0; i < 1000; ++i) {
+        const size_t pos = rng() % expected.size();
+        list.erase(list.nth(pos));
+        expected.erase(expected.begin() + pos);
+    }
+    return list;
+}
+
+} // namespace
+
+TEST(Parallel, forEachAndCountIf) {
+    std::vector<int> expected;
+    auto list = RandomList<unrolled_list<int, 64>>(expected, 1);
+
+    for_each(std::execution::par, list, [](int& x) { x = x * 3 + 1; });
+    std::for_each(expected.begin(), expected.end(), [](int& x) { x = x * 3 + 1; });
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+
+    std::atomic<size_t> visited = 0;
+    for_each(std::execution::par_unseq, std::as_const(list), [&visited](int) { ++visited; });
+    ASSERT_EQ(visited, expected.size());
+
+    const auto odd = [](int x) { return x % 2 != 0; };
+    ASSERT_EQ(count_if(std::execution::par, list, odd), std::count_if(expected.begin(), expected.end(), odd));
+    ASSERT_EQ(count_if(std::execution::seq, list, odd), std::count_if(expected.begin(), expected.end(), odd));
+}
+
+TEST(Parallel, transformAndReduce) {
+    std::vector<int> expected;
+    const auto list = RandomList<unrolled_list<int, 100>>(expected, 2);
+
+    std::vector<long> out(list.size());
+    const auto end = transform(std::execution::par, list, out.begin(), [](int x) { return x * 2L; });
+    ASSERT_EQ(end, out.end());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(out[i], expected[i] * 2L);
+    }
+
+    ASSERT_EQ(reduce(std::execution::par, list, 0L), std::accumulate(expected.begin(), expected.end(), 0L));
+    ASSERT_EQ(reduce(std::execution::par, list, 0, [](int a, int b) { return std::max(a, b); }),
+              *std::max_element(expected.begin(), expected.end()));
+
+    const unrolled_list<int> empty;
+    ASSERT_EQ(reduce(std::execution::par, empty, 5L), 5L);
+}
+
+TEST(Parallel, sortKeepsLayout) {
+    std::vector<int> expected;
+    auto list = RandomList<unrolled_list<int, 32, std::allocator<int>, unrolled_list_node_index>>(expected, 3);
+
+    sort(std::execution::par, list);
+    std::sort(expected.begin(), expected.end());
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+
+    sort(std::execution::par, list, std::greater<>());
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+    ASSERT_EQ(list[12345], expected[12345]);
+}
+
+TEST(Parallel, sortStrings) {
+    std::mt19937 rng(4);
+    unrolled_list<std::string, 16> list;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 50000; ++i) {
+        std::string value = std::to_string(rng()) + std::string(20, 'x');
+        list.push_back(value);
+        expected.push_back(value);
+    }
+
+    sort(std::execution::par, list);
+    std::sort(expected.begin(), expected.end());
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+}
+
+TEST(Parallel, exceptionIsRethrown) {
+    std::vector<int> expected;
+    auto list = RandomList<unrolled_list<int, 64>>(expected, 5);
+    const int poison = expected[kSize / 2];
+
+    ASSERT_THROW(
+        for_each(std::execution::par, list, [poison](int x) {
+            if (x == poison) {
+                throw std::runtime_error("poison");
+            }
+        }),
+        std::runtime_error);
+
+    ASSERT_THROW(
+        sort(std::execution::par, list, [poison](int a, int b) {
+            if (a == poison || b == poison) {
+                throw std::runtime_error("poison");
+            }
+            return a < b;
+        }),
+        std::runtime_error);
+
+    // После исключения в sort элементы остаются на месте, но в неизвестном порядке
+    std::sort(expected.begin(), expected.end());
+    std::vector<int> actual(list.begin(), list.end());
+    std::sort(actual.begin(), actual.end());
+    ASSERT_EQ(actual, expected);
+}
+
+TEST(Parallel, unseqStaysInCallingThread) {
+    std::vector<int> expected;
+    auto list = RandomList<unrolled_list<int, 64>>(expected, 5);
+
+    // Функтор не потокобезопасен: unseq разрешает только векторизацию
+    std::set<std::thread::id> threads;
+    for_each(std::execution::unseq, list, [&threads](int&) { threads.insert(std::this_thread::get_id()); });
+    ASSERT_THAT(threads, ::testing::ElementsAre(std::this_thread::get_id()));
+
+    threads.clear();
+    count_if(std::execution::unseq, list, [&threads](int) {
+        threads.insert(std::this_thread::get_id());
+        return true;
+    });
+    ASSERT_THAT(threads, ::testing::ElementsAre(std::this_thread::get_id()));
+}
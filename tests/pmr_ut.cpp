@@ -0,0 +1,157 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+/*
+    Тесты на работу с std::pmr::polymorphic_allocator.
+    Проверяется, что ноды и элементы берутся из ресурса списка и что
+    копирование не трогает исходный список
+*/
+
+namespace {
+
+class CountingResource : public std::pmr::memory_resource {
+public:
+    long allocations = 0;
+    long deallocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+class CountingMonotonicResource : public std::pmr::monotonic_buffer_resource {
+public:
+    using std::pmr::monotonic_buffer_resource::monotonic_buffer_resource;
+
+    long deallocations = 0;
+
+private:
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        ++deallocations;
+        std::pmr::monotonic_buffer_resource::do_deallocate(p, bytes, alignment);
+    }
+};
+
+} // namespace
+
+TEST(Pmr, elementsUseListResource) {
+    CountingResource resource;
+    {
+        unrolled_list_pmr<std::pmr::string, 4> list(&resource);
+        for (int i = 0; i < 20; ++i) {
+            list.emplace_back(std::string(40, 'a' + i));
+        }
+        list.insert(list.nth(10), std::pmr::string(40, 'z'));
+
+        for (const auto& item : list) {
+            ASSERT_EQ(item.get_allocator().resource(), &resource);
+        }
+        ASSERT_GT(resource.allocations, 20);
+    }
+    ASSERT_EQ(resource.allocations, resource.deallocations);
+}
+
+TEST(Pmr, copyWithAllocatorKeepsSource) {
+    CountingResource first;
+    CountingResource second;
+
+    unrolled_list_pmr<int, 8> source(&first);
+    for (int i = 0; i < 100; ++i) {
+        source.push_back(i);
+    }
+
+    const unrolled_list_pmr<int, 8>& source_ref = source;
+    unrolled_list_pmr<int, 8> copy(source_ref, &second);
+
+    ASSERT_EQ(source.size(), 100);
+    ASSERT_THAT(copy, ::testing::ElementsAreArray(source));
+    ASSERT_EQ(copy.get_allocator().resource(), &second);
+    ASSERT_GT(second.allocations, 0);
+}
+
+TEST(Pmr, copyUsesDefaultResource) {
+    CountingResource resource;
+    unrolled_list_pmr<int, 8> source({1, 2, 3}, &resource);
+
+    unrolled_list_pmr<int, 8> copy(source);
+
+    ASSERT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+    ASSERT_THAT(copy, ::testing::ElementsAre(1, 2, 3));
+}
+
+TEST(Pmr, assignmentKeepsOwnResource) {
+    CountingResource first;
+    CountingResource second;
+    {
+        unrolled_list_pmr<int, 8> lhs({1, 2, 3}, &first);
+        unrolled_list_pmr<int, 8> rhs(&second);
+        for (int i = 0; i < 50; ++i) {
+            rhs.push_back(i);
+        }
+
+        const long second_allocations = second.allocations;
+        lhs = rhs;
+
+        ASSERT_EQ(lhs.get_allocator().resource(), &first);
+        ASSERT_EQ(second.allocations, second_allocations);
+        ASSERT_THAT(lhs, ::testing::ElementsAreArray(rhs));
+    }
+    ASSERT_EQ(first.allocations, first.deallocations);
+    ASSERT_EQ(second.allocations, second.deallocations);
+}
+
+TEST(Pmr, monotonicTeardownSkipsDeallocation) {
+    CountingMonotonicResource resource;
+    {
+        unrolled_list_pmr<int, 16> list(&resource);
+        for (int i = 0; i < 1000; ++i) {
+            list.push_back(i);
+        }
+        list.clear();
+        ASSERT_TRUE(list.empty());
+
+        for (int i = 0; i < 100; ++i) {
+            list.push_front(i);
+        }
+        ASSERT_EQ(list.size(), 100);
+        ASSERT_EQ(list.front(), 99);
+    }
+    ASSERT_EQ(resource.deallocations, 0);
+}
+
+TEST(Pmr, monotonicStillDestroysElements) {
+    std::pmr::monotonic_buffer_resource resource;
+    std::vector<std::pmr::string> expected;
+    {
+        unrolled_list_pmr<std::pmr::string, 4> list(&resource);
+        for (int i = 0; i < 30; ++i) {
+            list.emplace_back(std::string(50, 'a' + i % 26));
+            expected.emplace_back(50, 'a' + i % 26);
+        }
+        ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+    }
+}
+
+TEST(Pmr, usingNamespaceStdStillSeesStdPmr) {
+    using namespace std;
+    pmr::vector<int> vector = {1, 2, 3};
+    unrolled_list_pmr<int, 8> list(vector.begin(), vector.end(), vector.get_allocator());
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3));
+}
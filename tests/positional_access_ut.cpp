@@ -0,0 +1,67 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <deque>
+
+/*
+    Тесты на позиционный доступ: at, operator[] и nth.
+    Ожидается, что результат совпадает с std::deque при любом заполнении нод
+*/
+
+TEST(PositionalAccess, atMatchesDeque) {
+    std::deque<int> std_deque;
+    unrolled_list<int, 7> unrolled_list;
+
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 3 == 0) {
+            std_deque.push_front(i);
+            unrolled_list.push_front(i);
+        } else {
+            std_deque.push_back(i);
+            unrolled_list.push_back(i);
+        }
+    }
+
+    for (size_t i = 0; i < std_deque.size(); ++i) {
+        ASSERT_EQ(unrolled_list.at(i), std_deque[i]);
+        ASSERT_EQ(unrolled_list[i], std_deque[i]);
+    }
+
+    ASSERT_THROW(unrolled_list.at(std_deque.size()), std::out_of_range);
+}
+
+TEST(PositionalAccess, nthReturnsIterator) {
+    unrolled_list<int, 4> unrolled_list;
+    for (int i = 0; i < 100; ++i) {
+        unrolled_list.push_back(i);
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        auto it = unrolled_list.nth(i);
+        ASSERT_EQ(*it, i);
+        if (i + 1 < 100) {
+            ASSERT_EQ(*(++it), i + 1);
+        }
+    }
+
+    ASSERT_EQ(unrolled_list.nth(100), unrolled_list.end());
+
+    const auto& const_list = unrolled_list;
+    ASSERT_EQ(*const_list.nth(42), 42);
+    ASSERT_EQ(const_list[99], 99);
+}
+
+TEST(PositionalAccess, writeThroughSubscript) {
+    unrolled_list<int, 5> unrolled_list(size_t{23}, 0);
+
+    for (size_t i = 0; i < unrolled_list.size(); ++i) {
+        unrolled_list[i] = static_cast<int>(i);
+    }
+
+    int expected = 0;
+    for (int value : unrolled_list) {
+        ASSERT_EQ(value, expected++);
+    }
+}
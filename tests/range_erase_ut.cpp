@@ -0,0 +1,80 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+/*
+    Тесты на удаление диапазона erase(first, last).
+    Результат и возвращаемый итератор сравниваются с std::vector
+*/
+
+TEST(RangeErase, matchesVector) {
+    for (size_t from : {0, 1, 7, 20, 63}) {
+        for (size_t count : {0, 1, 3, 8, 25, 80}) {
+            std::vector<int> expected;
+            unrolled_list<int, 8> list;
+            for (int i = 0; i < 100; ++i) {
+                expected.push_back(i);
+                if (i % 2 == 0) {
+                    list.push_back(i);
+                } else {
+                    list.insert(list.nth(list.size() / 2), i);
+                }
+            }
+            expected.assign(list.begin(), list.end());
+
+            const size_t to = std::min(from + count, expected.size());
+            auto it = list.erase(list.nth(from), list.nth(to));
+            expected.erase(expected.begin() + from, expected.begin() + to);
+
+            ASSERT_THAT(list, ::testing::ElementsAreArray(expected)) << from << " " << count;
+            ASSERT_EQ(list.index_of(it), from);
+            if (from < expected.size()) {
+                ASSERT_EQ(*it, expected[from]);
+            }
+        }
+    }
+}
+
+TEST(RangeErase, eraseEverything) {
+    unrolled_list<std::unique_ptr<int>, 4> list;
+    for (int i = 0; i < 50; ++i) {
+        list.push_back(std::make_unique<int>(i));
+    }
+
+    auto it = list.erase(list.begin(), list.end());
+    ASSERT_EQ(it, list.end());
+    ASSERT_TRUE(list.empty());
+
+    list.push_back(std::make_unique<int>(1));
+    ASSERT_EQ(*list.front(), 1);
+}
+
+TEST(RangeErase, randomWindowsIndexed) {
+    unrolled_list<int, 16, std::allocator<int>, unrolled_list_node_index> list;
+    std::vector<int> expected;
+    std::mt19937 rng(99);
+
+    for (int round = 0; round < 200; ++round) {
+        std::vector<int> chunk(rng() % 60, round);
+        list.append_range(chunk);
+        expected.insert(expected.end(), chunk.begin(), chunk.end());
+
+        if (!expected.empty()) {
+            const size_t from = rng() % expected.size();
+            const size_t to = from + rng() % (expected.size() - from + 1);
+            auto it = list.erase(list.nth(from), list.nth(to));
+            expected.erase(expected.begin() + from, expected.begin() + to);
+            ASSERT_EQ(list.index_of(it), from);
+        }
+    }
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+    for (size_t i = 0; i < expected.size(); i += 7) {
+        ASSERT_EQ(list.index_of(list.nth(i)), i);
+    }
+}
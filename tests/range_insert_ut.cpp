@@ -0,0 +1,133 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+    Тесты на вставку диапазона: insert(pos, first, last), insert(pos, n, value),
+    insert_range, append_range и prepend_range.
+    Результат сравнивается с std::vector, а вставка должна давать strong-гарантию
+*/
+
+TEST(RangeInsert, matchesVector) {
+    for (size_t count : {0, 1, 3, 7, 8, 20, 100}) {
+        for (size_t pos : {0, 1, 5, 17, 40}) {
+            std::vector<int> expected;
+            unrolled_list<int, 8> list;
+            for (int i = 0; i < 40; ++i) {
+                expected.push_back(i);
+                list.push_back(i);
+            }
+
+            std::vector<int> range;
+            for (size_t i = 0; i < count; ++i) {
+                range.push_back(1000 + static_cast<int>(i));
+            }
+
+            auto it = list.insert(list.nth(pos), range.begin(), range.end());
+            expected.insert(expected.begin() + pos, range.begin(), range.end());
+
+            ASSERT_THAT(list, ::testing::ElementsAreArray(expected)) << count << " " << pos;
+            ASSERT_EQ(list.index_of(it), pos);
+        }
+    }
+}
+
+TEST(RangeInsert, countCopies) {
+    unrolled_list<std::string, 4> list = {"a", "b", "c"};
+
+    auto it = list.insert(list.nth(1), size_t{10}, std::string("x"));
+    ASSERT_EQ(list.index_of(it), 1);
+    ASSERT_EQ(list.size(), 13);
+    ASSERT_EQ(list.front(), "a");
+    ASSERT_EQ(list.back(), "c");
+    ASSERT_EQ(list[10], "x");
+    ASSERT_EQ(list[11], "b");
+}
+
+TEST(RangeInsert, countCopiesOfOwnElement) {
+    unrolled_list<std::string, 8> list = {"first", "second"};
+
+    list.insert(list.begin(), size_t{3}, list.front());
+    ASSERT_THAT(list, ::testing::ElementsAre("first", "first", "first", "first", "second"));
+
+    list.insert(list.nth(1), size_t{2}, list.back());
+    ASSERT_THAT(list, ::testing::ElementsAre("first", "second", "second", "first", "first", "first", "second"));
+}
+
+TEST(RangeInsert, inputIterators) {
+    std::istringstream stream("1 2 3 4 5 6 7 8 9 10 11 12");
+    unrolled_list<int, 5> list = {100, 200};
+
+    list.insert(list.nth(1), std::istream_iterator<int>(stream), std::istream_iterator<int>());
+
+    ASSERT_THAT(list, ::testing::ElementsAre(100, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 200));
+}
+
+TEST(RangeInsert, appendAndPrepend) {
+    unrolled_list<int, 6> list;
+    std::list<int> expected;
+
+    for (int round = 0; round < 5; ++round) {
+        std::vector<int> back_range(round * 3 + 1, round);
+        std::list<int> front_range(round * 2 + 2, -round);
+
+        list.append_range(back_range);
+        list.prepend_range(front_range);
+        expected.insert(expected.end(), back_range.begin(), back_range.end());
+        expected.insert(expected.begin(), front_range.begin(), front_range.end());
+    }
+
+    list.insert_range(list.nth(list.size() / 2), std::vector<int>{7, 7, 7});
+    auto middle = expected.begin();
+    std::advance(middle, expected.size() / 2);
+    expected.insert(middle, {7, 7, 7});
+
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+}
+
+struct ThrowOnValue {
+    ThrowOnValue(int value)
+        : Value(value) {
+        if (value < 0) {
+            throw std::runtime_error("");
+        }
+    }
+
+    int Value;
+};
+
+/*
+    Диапазон содержит значение, на котором конструктор выбрасывает исключение.
+    Содержимое контейнера после этого не должно измениться
+*/
+TEST(RangeInsert, strongGuarantee) {
+    for (size_t pos : {0, 3, 10}) {
+        for (size_t bad : {0, 2, 9, 30}) {
+            unrolled_list<ThrowOnValue, 4> list;
+            for (int i = 0; i < 10; ++i) {
+                list.emplace_back(i);
+            }
+
+            std::vector<int> range(40, 1);
+            range[bad] = -1;
+
+            if (pos == 10) {
+                ASSERT_ANY_THROW(list.append_range(range));
+            } else {
+                ASSERT_ANY_THROW(list.insert(list.nth(pos), range.begin(), range.end()));
+            }
+
+            ASSERT_EQ(list.size(), 10);
+            int expected = 0;
+            for (const auto& item : list) {
+                ASSERT_EQ(item.Value, expected++);
+            }
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <random>
+#include <vector>
+
+#include "counting_allocator.hpp"
+
+/*
+    Тесты на политику перебалансировки нод.
+    Аллокатор считает количество живых нод, чтобы сравнить плотность
+    заполнения при разных политиках
+*/
+
+using Nodes = AllocatorCounters<CountingAllocatorTag>;
+
+template<typename Policy>
+using PolicyList = unrolled_list<int, 16, CountingAllocator<int>, unrolled_list_no_index, Policy>;
+
+template<typename List>
+long NodesAfterTailInserts() {
+    Nodes::Live = 0;
+    List list;
+    list.push_back(0);
+    for (int i = 1; i < 1600; ++i) {
+        list.insert(list.nth(list.size() - 1), i);
+    }
+    return Nodes::Live;
+}
+
+TEST(RebalancePolicy, tailSplitKeepsNodesDense) {
+    const long half = NodesAfterTailInserts<PolicyList<unrolled_list_default_rebalance>>();
+    const long dense = NodesAfterTailInserts<PolicyList<unrolled_list_dense_rebalance>>();
+
+    // При делении пополам хвостовые ноды остаются заполненными наполовину
+    ASSERT_GE(half, 190);
+    ASSERT_LT(dense, 120) << dense;
+}
+
+TEST(RebalancePolicy, borrowKeepsMinimumFill) {
+    using List = PolicyList<unrolled_list_rebalance_policy<50, 50, 50, true>>;
+    Nodes::Live = 0;
+    {
+        List list;
+        std::vector<int> expected;
+        for (int i = 0; i < 1600; ++i) {
+            list.push_back(i);
+            expected.push_back(i);
+        }
+
+        std::mt19937 rng(3);
+        for (int i = 0; i < 1200; ++i) {
+            const size_t pos = rng() % expected.size();
+            auto it = list.erase(list.nth(pos));
+            expected.erase(expected.begin() + pos);
+            ASSERT_EQ(list.index_of(it), pos);
+        }
+
+        ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+        // 400 элементов при заполнении не менее 8 из 16 дают не более 50 нод
+        ASSERT_LE(Nodes::Live - static_cast<long>(list.cached_nodes()), 51);
+    }
+    ASSERT_EQ(Nodes::Live, 0);
+}
+
+TEST(RebalancePolicy, policiesAgreeOnContents) {
+    PolicyList<unrolled_list_default_rebalance> plain;
+    PolicyList<unrolled_list_dense_rebalance> dense;
+    std::vector<int> expected;
+    std::mt19937 rng(17);
+
+    for (int step = 0; step < 5000; ++step) {
+        if (expected.size() < 20 || rng() % 5 < 3) {
+            const size_t pos = rng() % (expected.size() + 1);
+            plain.insert(plain.nth(pos), step);
+            dense.insert(dense.nth(pos), step);
+            expected.insert(expected.begin() + pos, step);
+        } else {
+            const size_t from = rng() % expected.size();
+            const size_t to = std::min(expected.size(), from + 1 + rng() % 20);
+            plain.erase(plain.nth(from), plain.nth(to));
+            dense.erase(dense.nth(from), dense.nth(to));
+            expected.erase(expected.begin() + from, expected.begin() + to);
+        }
+    }
+
+    ASSERT_THAT(plain, ::testing::ElementsAreArray(expected));
+    ASSERT_THAT(dense, ::testing::ElementsAreArray(expected));
+}
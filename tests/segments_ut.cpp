@@ -0,0 +1,120 @@
+#include <unrolled_list.hpp>
+#include <unrolled_list_algorithm.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+/*
+    Тесты на обход по сегментам (по одному std::span на ноду)
+    и на алгоритмы, построенные поверх него. Результаты сравниваются с std::vector
+*/
+
+namespace {
+
+unrolled_list<int, 8> MakeFragmented(std::vector<int>& expected) {
+    unrolled_list<int, 8> list;
+    for (int i = 0; i < 200; ++i) {
+        list.push_back(i);
+        expected.push_back(i);
+    }
+    for (int i = 0; i < 50; ++i) {
+        list.insert(list.nth(i * 3), -i);
+        expected.insert(expected.begin() + i * 3, -i);
+    }
+    for (int i = 0; i < 30; ++i) {
+        list.erase(list.nth(i * 5));
+        expected.erase(expected.begin() + i * 5);
+    }
+    return list;
+}
+
+} // namespace
+
+TEST(Segments, concatenationMatchesElements) {
+    std::vector<int> expected;
+    const auto list = MakeFragmented(expected);
+
+    std::vector<int> joined;
+    size_t segments = 0;
+    for (std::span<const int> segment : list.segments()) {
+        ASSERT_FALSE(segment.empty());
+        ASSERT_LE(segment.size(), 8);
+        joined.insert(joined.end(), segment.begin(), segment.end());
+        ++segments;
+    }
+
+    ASSERT_EQ(joined, expected);
+    ASSERT_GE(segments, expected.size() / 8);
+}
+
+TEST(Segments, subrangeIsClipped) {
+    std::vector<int> expected;
+    auto list = MakeFragmented(expected);
+
+    for (size_t first = 0; first < expected.size(); first += 7) {
+        for (size_t last = first; last <= expected.size(); last += 11) {
+            std::vector<int> joined;
+            for (auto segment : list.segments(list.nth(first), list.nth(last))) {
+                joined.insert(joined.end(), segment.begin(), segment.end());
+            }
+            ASSERT_THAT(joined, ::testing::ElementsAreArray(expected.begin() + first, expected.begin() + last));
+        }
+    }
+}
+
+TEST(Segments, emptyList) {
+    unrolled_list<std::string> list;
+
+    ASSERT_TRUE(list.segments().empty());
+    ASSERT_EQ(find(list, "a"), list.end());
+    ASSERT_EQ(count(list, "a"), 0);
+}
+
+TEST(Segments, algorithmsMatchVector) {
+    std::vector<int> expected;
+    auto list = MakeFragmented(expected);
+    const auto& const_list = list;
+
+    ASSERT_EQ(accumulate(const_list, 0L), std::accumulate(expected.begin(), expected.end(), 0L));
+    ASSERT_EQ(count(const_list, 0), std::count(expected.begin(), expected.end(), 0));
+    ASSERT_EQ(count_if(const_list, [](int x) { return x % 3 == 0; }),
+              std::count_if(expected.begin(), expected.end(), [](int x) { return x % 3 == 0; }));
+
+    long sum = 0;
+    for_each(const_list, [&sum](int x) { sum += x; });
+    ASSERT_EQ(sum, accumulate(const_list, 0L));
+
+    for (int value : {-1, 42, 199, 1000}) {
+        const auto it = find(list, value);
+        const auto expected_it = std::find(expected.begin(), expected.end(), value);
+        if (expected_it == expected.end()) {
+            ASSERT_EQ(it, list.end());
+        } else {
+            ASSERT_EQ(list.index_of(it), expected_it - expected.begin());
+            ASSERT_EQ(*it, value);
+        }
+    }
+
+    std::vector<int> copied(expected.size());
+    ASSERT_EQ(copy(const_list, copied.data()), copied.data() + copied.size());
+    ASSERT_EQ(copied, expected);
+}
+
+TEST(Segments, mutatingAlgorithms) {
+    std::vector<int> expected;
+    auto list = MakeFragmented(expected);
+
+    for_each(list, [](int& x) { x *= 2; });
+    *find_if(list, [](int x) { return x > 100; }) = -7;
+    fill(list, 0);
+    ASSERT_EQ(count(list, 0), expected.size());
+
+    for (auto segment : list.segments()) {
+        std::iota(segment.begin(), segment.end(), 1);
+    }
+    ASSERT_EQ(list.front(), 1);
+}
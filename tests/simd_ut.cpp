@@ -0,0 +1,120 @@
+#include <unrolled_list.hpp>
+#include <unrolled_list_simd.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+/*
+    Тесты на векторные ядра поиска и свёрток.
+    Каждое ядро запускается на всех наборах инструкций, которые есть у процессора,
+    результат сравнивается с алгоритмами стандартной библиотеки
+*/
+
+namespace {
+
+using unrolled_list_simd::isa;
+
+const isa kLevels[] = {isa::scalar, isa::sse, isa::avx2, isa::avx512};
+
+template<typename T>
+class SimdKernels : public ::testing::Test {
+protected:
+    unrolled_list<T, 37> list;
+    std::vector<T> expected;
+
+    void SetUp() override {
+        std::mt19937 rng(17);
+        for (int i = 0; i < 3000; ++i) {
+            const T value = static_cast<T>(static_cast<int>(rng() % 2001) - 1000);
+            list.push_back(value);
+            expected.push_back(value);
+        }
+        // Ноды разной заполненности, чтобы попасть в хвосты векторных циклов
+        for (int i = 0; i < 300; ++i) {
+            const size_t pos = rng() % expected.size();
+            list.erase(list.nth(pos));
+            expected.erase(expected.begin() + pos);
+        }
+    }
+};
+
+using ElementTypes = ::testing::Types<int32_t, int64_t, float, double>;
+TYPED_TEST_SUITE(SimdKernels, ElementTypes);
+
+} // namespace
+
+TYPED_TEST(SimdKernels, findAndCount) {
+    using T = TypeParam;
+    for (isa level : kLevels) {
+        for (T value : {T(-1000), T(0), T(7), T(999), T(5000)}) {
+            const auto it = unrolled_list_simd::find(this->list, value, level);
+            const auto expected_it = std::find(this->expected.begin(), this->expected.end(), value);
+            if (expected_it == this->expected.end()) {
+                ASSERT_EQ(it, this->list.end());
+            } else {
+                ASSERT_EQ(this->list.index_of(it), expected_it - this->expected.begin());
+            }
+
+            ASSERT_EQ(unrolled_list_simd::count(this->list, value, level),
+                      std::count(this->expected.begin(), this->expected.end(), value));
+        }
+    }
+}
+
+TYPED_TEST(SimdKernels, countIf) {
+    using T = TypeParam;
+    for (isa level : kLevels) {
+        const T threshold = T(123);
+        ASSERT_EQ(unrolled_list_simd::count_if(this->list, std::less<>(), threshold, level),
+                  std::count_if(this->expected.begin(), this->expected.end(), [&](T x) { return x < threshold; }));
+        ASSERT_EQ(unrolled_list_simd::count_if(this->list, std::greater_equal<T>(), threshold, level),
+                  std::count_if(this->expected.begin(), this->expected.end(), [&](T x) { return x >= threshold; }));
+        ASSERT_EQ(unrolled_list_simd::count_if(this->list, std::not_equal_to<>(), T(0), level),
+                  std::count_if(this->expected.begin(), this->expected.end(), [](T x) { return x != T(0); }));
+    }
+}
+
+TYPED_TEST(SimdKernels, reductions) {
+    using T = TypeParam;
+    const T expected_sum = std::accumulate(this->expected.begin(), this->expected.end(), T(0));
+    for (isa level : kLevels) {
+        ASSERT_EQ(unrolled_list_simd::sum(this->list, level), expected_sum);
+        ASSERT_EQ(unrolled_list_simd::min(this->list, level),
+                  *std::min_element(this->expected.begin(), this->expected.end()));
+        ASSERT_EQ(unrolled_list_simd::max(this->list, level),
+                  *std::max_element(this->expected.begin(), this->expected.end()));
+    }
+}
+
+TEST(Simd, emptyAndTinyLists) {
+    unrolled_list<int64_t, 512> list;
+
+    ASSERT_FALSE(unrolled_list_simd::min(list).has_value());
+    ASSERT_EQ(unrolled_list_simd::sum(list), 0);
+    ASSERT_EQ(unrolled_list_simd::find(list, int64_t{1}), list.end());
+
+    list.push_back(-5);
+    ASSERT_EQ(unrolled_list_simd::min(list), -5);
+    ASSERT_EQ(unrolled_list_simd::max(list), -5);
+    ASSERT_EQ(unrolled_list_simd::count(list, int64_t{-5}), 1);
+}
+
+TEST(Simd, integerSumWraps) {
+    unrolled_list<int32_t, 64> list;
+    for (int i = 0; i < 1000; ++i) {
+        list.push_back(std::numeric_limits<int32_t>::max());
+    }
+
+    uint32_t expected = 0;
+    for (int i = 0; i < 1000; ++i) {
+        expected += static_cast<uint32_t>(std::numeric_limits<int32_t>::max());
+    }
+    for (isa level : kLevels) {
+        ASSERT_EQ(unrolled_list_simd::sum(list, level), static_cast<int32_t>(expected));
+    }
+}
@@ -0,0 +1,165 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "counting_allocator.hpp"
+#include "list_factories.hpp"
+
+/*
+    Тесты на splice, split_at и append.
+    Содержимое сравнивается с std::vector, аллокатор считает выделенные ноды,
+    чтобы убедиться, что элементы переносятся перевязкой нод, а не копированием
+*/
+
+namespace {
+
+std::vector<int> Range(int from, int to) {
+    std::vector<int> result;
+    for (int i = from; i < to; ++i) {
+        result.push_back(i);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(Splice, wholeListRelinksNodes) {
+    using List = unrolled_list<int, 8, CountingAllocator<int>>;
+    auto lhs = Make<List>(0, 100);
+    auto rhs = Make<List>(100, 1100);
+
+    AllocatorCounters<CountingAllocatorTag>::Allocations = 0;
+    lhs.splice(lhs.nth(50), rhs);
+
+    // Разделяется только нода, в которую идёт вставка
+    ASSERT_LE(AllocatorCounters<CountingAllocatorTag>::Allocations, 1);
+    auto expected = Range(0, 50);
+    for (int i = 100; i < 1100; ++i) {
+        expected.push_back(i);
+    }
+    for (int i = 50; i < 100; ++i) {
+        expected.push_back(i);
+    }
+    ASSERT_THAT(lhs, ::testing::ElementsAreArray(expected));
+    ASSERT_EQ(lhs.size(), expected.size());
+    ASSERT_TRUE(rhs.empty());
+    ASSERT_EQ(rhs.size(), 0);
+
+    rhs.push_back(7);
+    ASSERT_THAT(rhs, ::testing::ElementsAre(7));
+}
+
+TEST(Splice, atEnds) {
+    auto list = Make<unrolled_list<int, 8>>(10, 20);
+    list.splice(list.cbegin(), Make<unrolled_list<int, 8>>(0, 10));
+    list.splice(list.cend(), Make<unrolled_list<int, 8>>(20, 30));
+    ASSERT_THAT(list, ::testing::ElementsAreArray(Range(0, 30)));
+
+    unrolled_list<int, 8> empty;
+    empty.splice(empty.cend(), list);
+    ASSERT_THAT(empty, ::testing::ElementsAreArray(Range(0, 30)));
+    ASSERT_TRUE(list.empty());
+    empty.splice(empty.cbegin(), list);
+    ASSERT_EQ(empty.size(), 30);
+}
+
+TEST(Splice, rangeMatchesVector) {
+    std::mt19937 rng(8);
+    for (int step = 0; step < 300; ++step) {
+        using List = unrolled_list<int, 8, std::allocator<int>, unrolled_list_node_index>;
+        auto lhs = Make<List>(0, 1 + rng() % 100);
+        auto rhs = Make<List>(1000, 1000 + 1 + rng() % 100);
+        auto lhs_expected = Range(0, lhs.size());
+        auto rhs_expected = Range(1000, 1000 + rhs.size());
+
+        const size_t first = rng() % (rhs.size() + 1);
+        const size_t last = first + rng() % (rhs.size() - first + 1);
+        const size_t pos = rng() % (lhs.size() + 1);
+
+        lhs.splice(lhs.nth(pos), rhs, rhs.nth(first), rhs.nth(last));
+        lhs_expected.insert(lhs_expected.begin() + pos, rhs_expected.begin() + first, rhs_expected.begin() + last);
+        rhs_expected.erase(rhs_expected.begin() + first, rhs_expected.begin() + last);
+
+        ASSERT_THAT(lhs, ::testing::ElementsAreArray(lhs_expected));
+        ASSERT_THAT(rhs, ::testing::ElementsAreArray(rhs_expected));
+        ASSERT_EQ(lhs.size(), lhs_expected.size());
+        ASSERT_EQ(rhs.size(), rhs_expected.size());
+        for (size_t i = 0; i < lhs_expected.size(); i += 7) {
+            ASSERT_EQ(lhs[i], lhs_expected[i]);
+        }
+        for (size_t i = 0; i < rhs_expected.size(); i += 7) {
+            ASSERT_EQ(rhs[i], rhs_expected[i]);
+        }
+    }
+}
+
+TEST(Splice, withinOneList) {
+    std::mt19937 rng(9);
+    for (int step = 0; step < 300; ++step) {
+        unrolled_list<std::string, 4> list;
+        std::vector<std::string> expected;
+        const int size = 1 + rng() % 60;
+        for (int i = 0; i < size; ++i) {
+            list.push_back(std::to_string(i));
+            expected.push_back(std::to_string(i));
+        }
+
+        const size_t first = rng() % size;
+        const size_t last = first + 1 + rng() % (size - first);
+        size_t pos = rng() % (size - (last - first) + 1);
+        if (pos > first) {
+            pos += last - first;
+        }
+
+        list.splice(list.nth(pos), list, list.nth(first), list.nth(last));
+        std::vector<std::string> moved(expected.begin() + first, expected.begin() + last);
+        if (pos <= first) {
+            expected.erase(expected.begin() + first, expected.begin() + last);
+            expected.insert(expected.begin() + pos, moved.begin(), moved.end());
+        } else {
+            expected.insert(expected.begin() + pos, moved.begin(), moved.end());
+            expected.erase(expected.begin() + first, expected.begin() + last);
+        }
+
+        ASSERT_THAT(list, ::testing::ElementsAreArray(expected)) << first << " " << last << " " << pos;
+        ASSERT_EQ(list.size(), expected.size());
+    }
+}
+
+TEST(Splice, splitAtAndAppend) {
+    for (int at : {0, 1, 7, 8, 50, 99, 100}) {
+        auto list = Make<unrolled_list<int, 8>>(0, 100);
+        auto rest = list.split_at(list.nth(at));
+
+        ASSERT_THAT(list, ::testing::ElementsAreArray(Range(0, at)));
+        ASSERT_THAT(rest, ::testing::ElementsAreArray(Range(at, 100)));
+
+        list.append(std::move(rest));
+        ASSERT_THAT(list, ::testing::ElementsAreArray(Range(0, 100)));
+        ASSERT_EQ(list.size(), 100);
+    }
+}
+
+TEST(Splice, unequalAllocatorsMoveElements) {
+    std::pmr::monotonic_buffer_resource first_resource;
+    std::pmr::unsynchronized_pool_resource second_resource;
+    unrolled_list_pmr<std::pmr::string, 4> lhs(&first_resource);
+    unrolled_list_pmr<std::pmr::string, 4> rhs(&second_resource);
+    for (int i = 0; i < 10; ++i) {
+        lhs.push_back(std::pmr::string(1, static_cast<char>('a' + i)));
+        rhs.push_back(std::pmr::string(1, static_cast<char>('A' + i)));
+    }
+
+    lhs.splice(lhs.nth(5), rhs, rhs.nth(2), rhs.nth(4));
+    ASSERT_THAT(lhs, ::testing::ElementsAre("a", "b", "c", "d", "e", "C", "D", "f", "g", "h", "i", "j"));
+    ASSERT_THAT(rhs, ::testing::ElementsAre("A", "B", "E", "F", "G", "H", "I", "J"));
+    for (const auto& item : lhs) {
+        ASSERT_EQ(item.get_allocator().resource(), &first_resource);
+    }
+}
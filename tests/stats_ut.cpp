@@ -0,0 +1,116 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <numeric>
+#include <string>
+
+/*
+    Тесты на политику сбора статистики.
+    Без политики список не должен становиться больше,
+    со счётчиками проверяются выделения нод, разделения, слияния и сдвиги элементов
+*/
+
+namespace {
+
+template<typename T, size_t N = 8>
+using CountedList = unrolled_list<T, N, std::allocator<T>, unrolled_list_no_index,
+                                  unrolled_list_default_rebalance, unrolled_list_counting_stats>;
+
+} // namespace
+
+static_assert(std::is_empty_v<unrolled_list_no_stats::counters>);
+static_assert(sizeof(CountedList<int>) >= sizeof(unrolled_list<int, 8>) + sizeof(unrolled_list_stats));
+
+TEST(Stats, pushBackCountsAllocations) {
+    CountedList<int> list;
+    for (int i = 0; i < 80; ++i) {
+        list.push_back(i);
+    }
+
+    const auto stats = list.stats();
+    ASSERT_EQ(stats.node_allocations, 10);
+    ASSERT_EQ(stats.node_deallocations, 0);
+    ASSERT_EQ(stats.splits, 0);
+    ASSERT_EQ(stats.merges, 0);
+    ASSERT_EQ(stats.element_moves, 0);
+    ASSERT_EQ(stats.fill_histogram.back(), 10);
+    ASSERT_EQ(std::accumulate(stats.fill_histogram.begin(), stats.fill_histogram.end(), size_t{0}), 10);
+}
+
+TEST(Stats, insertSplitsAndEraseMerges) {
+    CountedList<std::string> list;
+    for (int i = 0; i < 8; ++i) {
+        list.push_back(std::to_string(i));
+    }
+    list.reset_stats();
+
+    list.insert(list.nth(2), "x");
+    auto stats = list.stats();
+    ASSERT_EQ(stats.splits, 1);
+    ASSERT_EQ(stats.node_allocations, 1);
+    ASSERT_GT(stats.element_moves, 0);
+    ASSERT_EQ(stats.fill_histogram[5] + stats.fill_histogram[6], 2);
+
+    list.reset_stats();
+    while (list.size() > 3) {
+        list.erase(list.begin());
+    }
+    stats = list.stats();
+    ASSERT_EQ(stats.merges, 1);
+    ASSERT_EQ(stats.splits, 0);
+    ASSERT_EQ(stats.nodes_reused, 0);
+    ASSERT_THAT(list, ::testing::ElementsAre("5", "6", "7"));
+}
+
+TEST(Stats, nodeCacheReuseIsCounted) {
+    CountedList<int, 4> list;
+    for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < 8; ++i) {
+            list.push_back(i);
+        }
+        for (int i = 0; i < 8; ++i) {
+            list.pop_front();
+        }
+    }
+
+    const auto stats = list.stats();
+    ASSERT_LE(stats.node_allocations, 3);
+    ASSERT_EQ(stats.node_allocations + stats.nodes_reused, 200);
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(std::accumulate(stats.fill_histogram.begin(), stats.fill_histogram.end(), size_t{0}), 0);
+
+    list.shrink_to_fit();
+    ASSERT_EQ(list.stats().node_deallocations, list.stats().node_allocations);
+}
+
+TEST(Stats, pushFrontShiftsAreCounted) {
+    CountedList<int> list;
+    list.push_back(0);
+    list.reset_stats();
+
+    // В голове нет места перед первым элементом, поэтому нода сдвигается
+    list.push_front(1);
+    ASSERT_EQ(list.stats().element_moves, 1);
+}
+
+TEST(Stats, insertIntoNodeCountsShifts) {
+    CountedList<int> ints;
+    CountedList<std::string> strings;
+    for (int i = 0; i < 6; ++i) {
+        ints.push_back(i);
+        strings.push_back(std::to_string(i));
+    }
+    ints.reset_stats();
+    strings.reset_stats();
+
+    ints.insert(ints.nth(4), 100);
+    strings.insert(strings.nth(4), "x");
+
+    ASSERT_EQ(ints.stats().splits, 0);
+    ASSERT_EQ(strings.stats().splits, 0);
+    ASSERT_EQ(ints.stats().element_moves, 2);
+    ASSERT_EQ(strings.stats().element_moves, 2);
+    ASSERT_THAT(strings, ::testing::ElementsAre("0", "1", "2", "3", "x", "4", "5"));
+}
@@ -0,0 +1,94 @@
+#include <unrolled_list.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <deque>
+#include <random>
+
+#include "counting_allocator.hpp"
+
+/*
+    Тесты на быстрые пути для тривиально копируемых типов.
+    Элементы двигаются через memcpy/memmove, результат сравнивается с std::deque.
+    Аллокатор со своим construct должен по-прежнему вызываться на каждый элемент
+*/
+
+namespace {
+
+struct ConstructTag : CountingAllocatorTag {
+    static constexpr bool CountConstructs = true;
+};
+
+struct Record {
+    int64_t key;
+    int64_t value;
+
+    bool operator==(const Record&) const = default;
+};
+
+template<typename List>
+void RandomOperations(List& list, std::deque<Record>& expected, unsigned seed) {
+    std::mt19937 rng(seed);
+    for (int64_t i = 0; i < 20000; ++i) {
+        const Record record{i, -i};
+        const size_t pos = expected.empty() ? 0 : rng() % expected.size();
+        switch (rng() % 6) {
+            case 0:
+                list.push_back(record);
+                expected.push_back(record);
+                break;
+            case 1:
+                list.push_front(record);
+                expected.push_front(record);
+                break;
+            case 2:
+            case 3:
+                list.insert(list.nth(pos), record);
+                expected.insert(expected.begin() + pos, record);
+                break;
+            case 4:
+                if (!expected.empty()) {
+                    list.erase(list.nth(pos));
+                    expected.erase(expected.begin() + pos);
+                }
+                break;
+            case 5:
+                if (expected.size() > 10) {
+                    const size_t from = pos % (expected.size() - 10);
+                    list.erase(list.nth(from), list.nth(from + 10));
+                    expected.erase(expected.begin() + from, expected.begin() + from + 10);
+                }
+                break;
+        }
+    }
+}
+
+} // namespace
+
+TEST(TrivialFastPath, recordsMatchDeque) {
+    unrolled_list<Record, 32, std::allocator<Record>, unrolled_list_node_index, unrolled_list_dense_rebalance> list;
+    std::deque<Record> expected;
+
+    RandomOperations(list, expected, 11);
+
+    ASSERT_EQ(list.size(), expected.size());
+    ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+}
+
+TEST(TrivialFastPath, allocatorConstructIsNotBypassed) {
+    using Counter = AllocatorCounters<ConstructTag>;
+    Counter::Constructed = 0;
+    Counter::Destroyed = 0;
+    {
+        unrolled_list<Record, 8, CountingAllocator<Record, ConstructTag>> list;
+        std::deque<Record> expected;
+
+        RandomOperations(list, expected, 5);
+
+        ASSERT_THAT(list, ::testing::ElementsAreArray(expected));
+        ASSERT_EQ(Counter::Constructed - Counter::Destroyed, static_cast<long>(list.size()));
+    }
+    ASSERT_EQ(Counter::Constructed, Counter::Destroyed);
+}